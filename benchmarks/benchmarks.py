@@ -64,7 +64,10 @@ def main():
              'binary_tree', 
              'linear_chain', 
              'matrix_multiplication',
-             'mnist'],
+             'mnist',
+             'data_pipeline',
+             'forward_for_each',
+             'parallel_for_latency'],
     required=True
   )
 
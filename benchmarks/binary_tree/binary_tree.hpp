@@ -9,7 +9,7 @@
 #include <cmath>
 #include <atomic>
 
-std::chrono::microseconds measure_time_taskflow(size_t, unsigned);
+std::chrono::microseconds measure_time_taskflow(size_t, unsigned, bool);
 std::chrono::microseconds measure_time_tbb(size_t, unsigned);
 std::chrono::microseconds measure_time_omp(size_t, unsigned);
 
@@ -5,7 +5,8 @@ void binary_tree(
   const std::string& model,
   const size_t num_layers,
   const unsigned num_threads, 
-  const unsigned num_rounds
+  const unsigned num_rounds,
+  const bool critical_path
   ) {
 
   std::cout << std::setw(12) << "size"
@@ -18,7 +19,7 @@ void binary_tree(
 
     for(unsigned j=0; j<num_rounds; ++j) {
       if(model == "tf") {
-        runtime += measure_time_taskflow(i, num_threads).count();
+        runtime += measure_time_taskflow(i, num_threads, critical_path).count();
       }
       else if(model == "tbb") {
         runtime += measure_time_tbb(i, num_threads).count();
@@ -57,14 +58,18 @@ int main(int argc, char* argv[]) {
         return "";
      });
 
+  bool critical_path {false};
+  app.add_flag("-c,--critical_path", critical_path, "enable critical-path scheduling (tf only)");
+
   CLI11_PARSE(app, argc, argv);
    
   std::cout << "model=" << model << ' '
             << "num_threads=" << num_threads << ' '
             << "num_rounds=" << num_rounds << ' '
+            << "critical_path=" << critical_path << ' '
             << std::endl;
 
-  binary_tree(model, num_layers, num_threads, num_rounds);
+  binary_tree(model, num_layers, num_threads, num_rounds, critical_path);
 
   return 0;
 }
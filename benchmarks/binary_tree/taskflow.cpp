@@ -2,7 +2,7 @@
 #include <taskflow/taskflow.hpp> 
 
 // binary_tree_taskflow
-void binary_tree_taskflow(size_t num_layers, unsigned num_threads) {
+void binary_tree_taskflow(size_t num_layers, unsigned num_threads, bool critical_path) {
 
   std::atomic<size_t> counter {0};
 
@@ -11,6 +11,8 @@ void binary_tree_taskflow(size_t num_layers, unsigned num_threads) {
   tf::Executor executor(num_threads);
   tf::Taskflow taskflow;
 
+  taskflow.critical_path_scheduling(critical_path);
+
   for(unsigned i=1; i<tasks.size(); i++) {
     tasks[i] = taskflow.emplace([&](){
       counter.fetch_add(1, std::memory_order_relaxed);
@@ -31,10 +33,11 @@ void binary_tree_taskflow(size_t num_layers, unsigned num_threads) {
 
 std::chrono::microseconds measure_time_taskflow(
   size_t num_layers,
-  unsigned num_threads
+  unsigned num_threads,
+  bool critical_path
 ) {
   auto beg = std::chrono::high_resolution_clock::now();
-  binary_tree_taskflow(num_layers, num_threads);
+  binary_tree_taskflow(num_layers, num_threads, critical_path);
   auto end = std::chrono::high_resolution_clock::now();
   return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
 }
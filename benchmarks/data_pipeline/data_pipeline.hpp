@@ -0,0 +1,27 @@
+#include <algorithm> 
+#include <cassert>
+#include <cstdio>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <random>
+#include <cmath>
+#include <atomic>
+#include <string>
+#include <vector>
+
+// number of pipes in the benchmark pipeline (read, decode, transform, write)
+constexpr size_t NUM_PIPES = 4;
+
+// work done by every pipe on a token
+inline int work(int x) {
+  for(int i=0; i<100; i++) {
+    x = (x * 1103515245 + 12345) & 0x7fffffff;
+  }
+  return x;
+}
+
+std::chrono::microseconds measure_time_taskflow(std::string, size_t, size_t, unsigned);
+std::chrono::microseconds measure_time_tbb(std::string, size_t, size_t, unsigned);
+std::chrono::microseconds measure_time_omp(std::string, size_t, size_t, unsigned);
@@ -0,0 +1,89 @@
+#include "data_pipeline.hpp"
+#include <CLI11.hpp>
+
+void data_pipeline(
+  const std::string& model,
+  const std::string& pipes,
+  const size_t num_lines,
+  const size_t log_length,
+  const unsigned num_threads, 
+  const unsigned num_rounds
+  ) {
+
+  std::cout << std::setw(12) << "tokens"
+            << std::setw(12) << "runtime"
+            << std::endl;
+  
+  for(size_t i=1; i<=log_length; ++i) {
+
+    size_t L = 1 << i;
+
+    double runtime {0.0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+      if(model == "tf") {
+        runtime += measure_time_taskflow(pipes, num_lines, L, num_threads).count();
+      }
+      else if(model == "tbb") {
+        runtime += measure_time_tbb(pipes, num_lines, L, num_threads).count();
+      }
+      else if(model == "omp") {
+        runtime += measure_time_omp(pipes, num_lines, L, num_threads).count();
+      }
+      else assert(false);
+    }
+
+    std::cout << std::setw(12) << L
+              << std::setw(12) << runtime / num_rounds / 1e3
+              << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"DataPipeline"};
+
+  unsigned num_threads {1}; 
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};  
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+  
+  size_t log_length {20};  
+  app.add_option("-l,--log_length", log_length, "number of tokens in log scale (default=20)");
+  
+  size_t num_lines {8};  
+  app.add_option("-n,--num_lines", num_lines, "number of parallel lines (default=8)");
+  
+  std::string pipes = "sppp";
+  app.add_option("-p,--pipes", pipes, "types of the four pipes, s (serial) or p (parallel), the first must be s (default=sppp)")
+     ->check([] (const std::string& p) {
+        if(p.size() != NUM_PIPES || p[0] != 's' ||
+           p.find_first_not_of("sp") != std::string::npos) {
+          return "pipes should be four characters of s or p starting with s";
+        }
+        return "";
+     });
+
+  std::string model = "tf";
+  app.add_option("-m,--model", model, "model name tbb|omp|tf (default=tf)")
+     ->check([] (const std::string& m) {
+        if(m != "tbb" && m != "tf" && m != "omp") {
+          return "model name should be \"tbb\", \"omp\", or \"tf\"";
+        }
+        return "";
+     });
+
+  CLI11_PARSE(app, argc, argv);
+   
+  std::cout << "model=" << model << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << "num_lines=" << num_lines << ' '
+            << "pipes=" << pipes << ' '
+            << std::endl;
+
+  data_pipeline(model, pipes, num_lines, log_length, num_threads, num_rounds);
+
+  return 0;
+}
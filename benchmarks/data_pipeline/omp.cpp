@@ -0,0 +1,71 @@
+#include "data_pipeline.hpp"
+#include <omp.h>
+
+// data_pipeline_omp
+// Each token is a chain of tasks through the pipes. A serial pipe adds an
+// inout dependency on its own sentinel, which orders the tokens at that 
+// pipe in their creation order. OpenMP has no means to bound the number of
+// tokens in flight, so num_lines is used only to size the buffer.
+void data_pipeline_omp(
+  const std::string& pipes, size_t num_lines, size_t num_tokens, unsigned num_threads
+) {
+
+  std::vector<int> buffer(num_tokens);
+  std::vector<char> serial(NUM_PIPES);
+  size_t checksum {0};
+
+  int* B = buffer.data();
+  char* S = serial.data();
+
+  (void)num_lines;
+  (void)S;         // only referenced in dependence clauses
+
+  #pragma omp parallel num_threads(num_threads)
+  {
+    #pragma omp single
+    {
+      for(size_t t=0; t<num_tokens; ++t) {
+
+        // read
+        #pragma omp task firstprivate(t) depend(out:B[t]) depend(inout:S[0])
+        {
+          B[t] = work(static_cast<int>(t));
+        }
+
+        for(size_t p=1; p<NUM_PIPES; ++p) {
+          if(pipes[p] == 's') {
+            #pragma omp task firstprivate(t, p) depend(inout:B[t]) depend(inout:S[p])
+            {
+              if(p == NUM_PIPES - 1) {
+                checksum += B[t] & 1;
+              }
+              else {
+                B[t] = work(B[t]);
+              }
+            }
+          }
+          else {
+            #pragma omp task firstprivate(t) depend(inout:B[t])
+            {
+              B[t] = work(B[t]);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  assert(checksum <= num_tokens);
+}
+
+std::chrono::microseconds measure_time_omp(
+  std::string pipes,
+  size_t num_lines,
+  size_t num_tokens,
+  unsigned num_threads
+) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  data_pipeline_omp(pipes, num_lines, num_tokens, num_threads);
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
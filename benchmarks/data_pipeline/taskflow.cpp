@@ -0,0 +1,65 @@
+#include "data_pipeline.hpp"
+#include <taskflow/taskflow.hpp> 
+
+// data_pipeline_taskflow
+void data_pipeline_taskflow(
+  const std::string& pipes, size_t num_lines, size_t num_tokens, unsigned num_threads
+) {
+
+  tf::Executor executor(num_threads);
+  tf::Taskflow taskflow;
+
+  std::vector<int> buffer(num_lines);
+  size_t checksum {0};
+
+  auto type = [&] (size_t p) {
+    return pipes[p] == 's' ? tf::PipeType::SERIAL : tf::PipeType::PARALLEL;
+  };
+
+  tf::Pipeline pl(num_lines,
+    // read
+    tf::Pipe{tf::PipeType::SERIAL, [&](tf::Pipeflow& pf) {
+      if(pf.token() == num_tokens) {
+        pf.stop();
+        return;
+      }
+      buffer[pf.line()] = work(static_cast<int>(pf.token()));
+    }},
+    // decode
+    tf::Pipe{type(1), [&](tf::Pipeflow& pf) {
+      buffer[pf.line()] = work(buffer[pf.line()]);
+    }},
+    // transform
+    tf::Pipe{type(2), [&](tf::Pipeflow& pf) {
+      buffer[pf.line()] = work(buffer[pf.line()]);
+    }},
+    // write
+    tf::Pipe{type(3), [&](tf::Pipeflow& pf) {
+      if(pipes[3] == 's') {
+        checksum += buffer[pf.line()] & 1;
+      }
+      else {
+        buffer[pf.line()] = work(buffer[pf.line()]);
+      }
+    }}
+  );
+
+  taskflow.pipeline(pl);
+  
+  executor.run(taskflow).get();
+
+  assert(pl.num_tokens() == num_tokens);
+  assert(checksum <= num_tokens);
+}
+
+std::chrono::microseconds measure_time_taskflow(
+  std::string pipes,
+  size_t num_lines,
+  size_t num_tokens,
+  unsigned num_threads
+) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  data_pipeline_taskflow(pipes, num_lines, num_tokens, num_threads);
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
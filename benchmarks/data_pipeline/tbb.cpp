@@ -0,0 +1,60 @@
+#include "data_pipeline.hpp"
+#include <tbb/global_control.h>
+#include <tbb/pipeline.h>
+
+// data_pipeline_tbb
+void data_pipeline_tbb(
+  const std::string& pipes, size_t num_lines, size_t num_tokens, unsigned num_threads
+) {
+
+  tbb::global_control c(
+    tbb::global_control::max_allowed_parallelism, num_threads
+  );
+
+  size_t token {0};
+  size_t checksum {0};
+
+  auto mode = [&] (size_t p) {
+    return pipes[p] == 's' ? tbb::filter::serial_in_order : tbb::filter::parallel;
+  };
+
+  tbb::parallel_pipeline(num_lines,
+    // read
+    tbb::make_filter<void, int>(tbb::filter::serial_in_order, 
+      [&](tbb::flow_control& fc) -> int {
+        if(token == num_tokens) {
+          fc.stop();
+          return 0;
+        }
+        return work(static_cast<int>(token++));
+      }
+    ) &
+    // decode
+    tbb::make_filter<int, int>(mode(1), [](int x) { return work(x); }) &
+    // transform
+    tbb::make_filter<int, int>(mode(2), [](int x) { return work(x); }) &
+    // write
+    tbb::make_filter<int, void>(mode(3), [&](int x) {
+      if(pipes[3] == 's') {
+        checksum += x & 1;
+      }
+      else {
+        work(x);
+      }
+    })
+  );
+
+  assert(checksum <= num_tokens);
+}
+
+std::chrono::microseconds measure_time_tbb(
+  std::string pipes,
+  size_t num_lines,
+  size_t num_tokens,
+  unsigned num_threads
+) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  data_pipeline_tbb(pipes, num_lines, num_tokens, num_threads);
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
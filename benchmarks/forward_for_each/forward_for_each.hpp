@@ -0,0 +1,28 @@
+#include <algorithm> 
+#include <cassert>
+#include <cstdio>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <random>
+#include <cmath>
+#include <atomic>
+#include <string>
+#include <list>
+#include <map>
+
+inline std::list<double> list;
+inline std::map<size_t, double> map;
+
+// work done on every element
+inline double work(double x) {
+  for(int i=0; i<16; i++) {
+    x = std::sqrt(x * x + 1.0);
+  }
+  return x;
+}
+
+std::chrono::microseconds measure_time_taskflow(const std::string&, unsigned);
+std::chrono::microseconds measure_time_tbb(const std::string&, unsigned);
+std::chrono::microseconds measure_time_omp(const std::string&, unsigned);
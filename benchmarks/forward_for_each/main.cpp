@@ -0,0 +1,93 @@
+#include "forward_for_each.hpp"
+#include <CLI11.hpp>
+
+void forward_for_each(
+  const std::string& model,
+  const std::string& container,
+  const size_t max_size,
+  const unsigned num_threads, 
+  const unsigned num_rounds
+  ) {
+
+  std::cout << std::setw(12) << "size"
+            << std::setw(12) << "runtime"
+            << std::endl;
+  
+  for(size_t N=10; N<=max_size; N = N*10) {
+
+    list.clear();
+    map.clear();
+
+    if(container == "list") {
+      list.resize(N, 1.0);
+    }
+    else {
+      for(size_t i=0; i<N; i++) {
+        map.emplace_hint(map.end(), i, 1.0);
+      }
+    }
+
+    double runtime {0.0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+      if(model == "tf") {
+        runtime += measure_time_taskflow(container, num_threads).count();
+      }
+      else if(model == "tbb") {
+        runtime += measure_time_tbb(container, num_threads).count();
+      }
+      else if(model == "omp") {
+        runtime += measure_time_omp(container, num_threads).count();
+      }
+      else assert(false);
+    }
+
+    std::cout << std::setw(12) << N
+              << std::setw(12) << runtime / num_rounds / 1e3
+              << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"ForwardForEach"};
+
+  unsigned num_threads {1}; 
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};  
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+  
+  size_t max_size {10000000};  
+  app.add_option("-n,--max_size", max_size, "maximum number of elements (default=10000000)");
+
+  std::string container = "list";
+  app.add_option("-c,--container", container, "container type list|map (default=list)")
+     ->check([] (const std::string& c) {
+        if(c != "list" && c != "map") {
+          return "container should be \"list\" or \"map\"";
+        }
+        return "";
+     });
+
+  std::string model = "tf";
+  app.add_option("-m,--model", model, "model name tbb|omp|tf (default=tf)")
+     ->check([] (const std::string& m) {
+        if(m != "tbb" && m != "tf" && m != "omp") {
+          return "model name should be \"tbb\", \"omp\", or \"tf\"";
+        }
+        return "";
+     });
+
+  CLI11_PARSE(app, argc, argv);
+   
+  std::cout << "model=" << model << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << "container=" << container << ' '
+            << std::endl;
+
+  forward_for_each(model, container, max_size, num_threads, num_rounds);
+
+  return 0;
+}
@@ -0,0 +1,54 @@
+#include "forward_for_each.hpp"
+#include <omp.h>
+
+// applies f to every element of [beg, end) using one task per chunk
+// of consecutive elements created by a single thread
+template <typename I, typename F>
+void omp_for_each(I beg, I end, F f) {
+
+  const size_t chunk_size = 1024;
+
+  #pragma omp parallel
+  {
+    #pragma omp single
+    {
+      while(beg != end) {
+        I first = beg;
+        for(size_t i=0; i<chunk_size && beg != end; i++) {
+          ++beg;
+        }
+        I last = beg;
+        #pragma omp task firstprivate(first, last)
+        {
+          std::for_each(first, last, f);
+        }
+      }
+    }
+  }
+}
+
+// forward_for_each_omp
+void forward_for_each_omp(const std::string& container, unsigned num_threads) {
+
+  omp_set_num_threads(num_threads);
+
+  if(container == "list") {
+    omp_for_each(list.begin(), list.end(), [](double& d){ 
+      d = work(d); 
+    });
+  }
+  else {
+    omp_for_each(map.begin(), map.end(), [](auto& kv){ 
+      kv.second = work(kv.second); 
+    });
+  }
+}
+
+std::chrono::microseconds measure_time_omp(
+  const std::string& container, unsigned num_threads
+) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  forward_for_each_omp(container, num_threads);
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
@@ -0,0 +1,31 @@
+#include "forward_for_each.hpp"
+#include <taskflow/taskflow.hpp> 
+
+// forward_for_each_taskflow
+void forward_for_each_taskflow(const std::string& container, unsigned num_threads) {
+
+  tf::Executor executor(num_threads); 
+  tf::Taskflow taskflow;
+
+  if(container == "list") {
+    taskflow.for_each(list.begin(), list.end(), [](double& d){ 
+      d = work(d); 
+    });
+  }
+  else {
+    taskflow.for_each(map.begin(), map.end(), [](auto& kv){ 
+      kv.second = work(kv.second); 
+    });
+  }
+
+  executor.run(taskflow).get(); 
+}
+
+std::chrono::microseconds measure_time_taskflow(
+  const std::string& container, unsigned num_threads
+) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  forward_for_each_taskflow(container, num_threads);
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
@@ -0,0 +1,31 @@
+#include "forward_for_each.hpp"
+#include <tbb/parallel_for_each.h>
+#include <tbb/global_control.h>
+
+// forward_for_each_tbb
+void forward_for_each_tbb(const std::string& container, unsigned num_threads) {
+
+  tbb::global_control c(
+    tbb::global_control::max_allowed_parallelism, num_threads
+  );
+
+  if(container == "list") {
+    tbb::parallel_for_each(list.begin(), list.end(), [](double& d){ 
+      d = work(d); 
+    });
+  }
+  else {
+    tbb::parallel_for_each(map.begin(), map.end(), [](auto& kv){ 
+      kv.second = work(kv.second); 
+    });
+  }
+}
+
+std::chrono::microseconds measure_time_tbb(
+  const std::string& container, unsigned num_threads
+) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  forward_for_each_tbb(container, num_threads);
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
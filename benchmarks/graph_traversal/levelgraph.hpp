@@ -266,7 +266,7 @@ inline void Node::mark(){
   }
 }
 
-std::chrono::microseconds measure_time_taskflow(LevelGraph&, unsigned);
+std::chrono::microseconds measure_time_taskflow(LevelGraph&, unsigned, bool, bool, bool);
 std::chrono::microseconds measure_time_omp(LevelGraph&, unsigned);
 std::chrono::microseconds measure_time_tbb(LevelGraph&, unsigned);
 
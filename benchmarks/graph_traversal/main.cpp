@@ -20,11 +20,23 @@ int main(int argc, char* argv[]) {
         return "";
      });
 
+  bool redundant {false};
+  app.add_flag("-e,--redundant_edges", redundant, "add an edge to every grandchild (tf only)");
+
+  bool optimize {false};
+  app.add_flag("-o,--optimize", optimize, "remove redundant edges before running (tf only)");
+
+  bool critical_path {false};
+  app.add_flag("-c,--critical_path", critical_path, "enable critical-path scheduling (tf only)");
+
   CLI11_PARSE(app, argc, argv);
 
   std::cout << "model=" << model << ' '
             << "num_threads=" << num_threads << ' '
             << "num_rounds=" << num_rounds << ' '
+            << "redundant_edges=" << redundant << ' '
+            << "optimize=" << optimize << ' '
+            << "critical_path=" << critical_path << ' '
             << std::endl;
 
   std::cout << std::setw(12) << "|V|+|E|"
@@ -39,7 +51,9 @@ int main(int argc, char* argv[]) {
     
     for(unsigned j=0; j<num_rounds; ++j) {
       if(model == "tf") {
-        runtime += measure_time_taskflow(graph, num_threads).count();
+        runtime += measure_time_taskflow(
+          graph, num_threads, redundant, optimize, critical_path
+        ).count();
       }
       else if(model == "tbb") {
         runtime += measure_time_tbb(graph, num_threads).count();
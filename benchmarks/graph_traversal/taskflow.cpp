@@ -6,7 +6,12 @@
 
 struct TF {
   
-  TF(LevelGraph& graph, unsigned num_threads) : executor(num_threads) {
+  TF(
+    LevelGraph& graph, unsigned num_threads, 
+    bool redundant, bool optimize, bool critical_path
+  ) : executor(num_threads) {
+
+    taskflow.critical_path_scheduling(critical_path);
 
     tasks.resize(graph.level()); 
     for(size_t i=0; i<tasks.size(); ++i) {
@@ -27,6 +32,26 @@ struct TF {
         } 
       }
     }
+
+    // adds the redundant edges a generated graph often has, from every 
+    // task to the successors of its successors
+    if(redundant) {
+      for(size_t l=0; l+2<graph.level(); l++){
+        for(size_t i=0; i<graph.length(); i++){
+          Node& n = graph.node_at(l, i);
+          for(size_t k=0; k<n._out_edges.size(); k++){
+            Node& m = graph.node_at(l+1, n._out_edges[k]);
+            for(size_t j=0; j<m._out_edges.size(); j++){
+              tasks[l][i].precede(tasks[l+2][m._out_edges[j]]);
+            }
+          }
+        }
+      }
+    }
+
+    if(optimize) {
+      taskflow.optimize();
+    }
   }
 
   void run() {
@@ -39,14 +64,22 @@ struct TF {
 
 };
 
-void traverse_level_graph_taskflow(LevelGraph& graph, unsigned num_threads){
-  TF tf(graph, num_threads);
+void traverse_level_graph_taskflow(
+  LevelGraph& graph, unsigned num_threads, 
+  bool redundant, bool optimize, bool critical_path
+){
+  TF tf(graph, num_threads, redundant, optimize, critical_path);
   tf.run();
 }
 
-std::chrono::microseconds measure_time_taskflow(LevelGraph& graph, unsigned num_threads){
+std::chrono::microseconds measure_time_taskflow(
+  LevelGraph& graph, unsigned num_threads, 
+  bool redundant, bool optimize, bool critical_path
+){
   auto beg = std::chrono::high_resolution_clock::now();
-  traverse_level_graph_taskflow(graph, num_threads);
+  traverse_level_graph_taskflow(
+    graph, num_threads, redundant, optimize, critical_path
+  );
   auto end = std::chrono::high_resolution_clock::now();
   return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
 }
@@ -5,7 +5,8 @@ void linear_chain(
   const std::string& model,
   const size_t log_length,
   const unsigned num_threads, 
-  const unsigned num_rounds
+  const unsigned num_rounds,
+  const bool fuse
   ) {
 
   std::cout << std::setw(12) << "length"
@@ -20,7 +21,7 @@ void linear_chain(
 
     for(unsigned j=0; j<num_rounds; ++j) {
       if(model == "tf") {
-        runtime += measure_time_taskflow(L, num_threads).count();
+        runtime += measure_time_taskflow(L, num_threads, fuse).count();
       }
       else if(model == "tbb") {
         runtime += measure_time_tbb(L, num_threads).count();
@@ -59,14 +60,18 @@ int main(int argc, char* argv[]) {
         return "";
      });
 
+  bool fuse {false};
+  app.add_flag("-f,--fuse", fuse, "fuse the chain into one task before running (tf only)");
+
   CLI11_PARSE(app, argc, argv);
    
   std::cout << "model=" << model << ' '
             << "num_threads=" << num_threads << ' '
             << "num_rounds=" << num_rounds << ' '
+            << "fuse=" << fuse << ' '
             << std::endl;
 
-  linear_chain(model, log_length, num_threads, num_rounds);
+  linear_chain(model, log_length, num_threads, num_rounds, fuse);
 
   return 0;
 }
@@ -2,7 +2,7 @@
 #include <taskflow/taskflow.hpp> 
 
 // binary_tree_taskflow
-void linear_chain_taskflow(size_t length, unsigned num_threads) {
+void linear_chain_taskflow(size_t length, unsigned num_threads, bool fuse) {
 
   size_t counter {0};
 
@@ -16,6 +16,10 @@ void linear_chain_taskflow(size_t length, unsigned num_threads) {
   }
 
   taskflow.linearize(tasks);
+
+  if(fuse) {
+    taskflow.fuse();
+  }
   
   executor.run(taskflow).get();
   assert(counter == tasks.size());
@@ -23,10 +27,11 @@ void linear_chain_taskflow(size_t length, unsigned num_threads) {
 
 std::chrono::microseconds measure_time_taskflow(
   size_t length,
-  unsigned num_threads
+  unsigned num_threads,
+  bool fuse
 ) {
   auto beg = std::chrono::high_resolution_clock::now();
-  linear_chain_taskflow(length, num_threads);
+  linear_chain_taskflow(length, num_threads, fuse);
   auto end = std::chrono::high_resolution_clock::now();
   return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
 }
@@ -25,11 +25,9 @@ void matrix_multiplication_taskflow(unsigned num_threads) {
     }
   });
 
-  auto comp_c = taskflow.for_each_index(0, N, 1, [&] (int i) {
-    for(int j=0; j<N; ++j) {
-      for(int k=0; k<N; k++) {
-        c[i][j] += a[i][k] * b[k][j];
-      }
+  auto comp_c = taskflow.for_each_index_2d(0, N, 0, N, [&] (int i, int j) {
+    for(int k=0; k<N; k++) {
+      c[i][j] += a[i][k] * b[k][j];
     }
   });
 
@@ -0,0 +1,79 @@
+#include "parallel_for_latency.hpp"
+#include <CLI11.hpp>
+
+void parallel_for_latency(
+  const std::string& model,
+  const size_t max_size,
+  const unsigned num_threads, 
+  const unsigned num_rounds
+  ) {
+
+  std::cout << std::setw(12) << "size"
+            << std::setw(12) << "runtime"
+            << std::endl;
+  
+  for(size_t N=1; N<=max_size; N = N*10) {
+
+    data.assign(N, 1.0);
+
+    double runtime {0.0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+      if(model == "tf") {
+        runtime += measure_time_taskflow(num_threads).count();
+      }
+      else if(model == "tfg") {
+        runtime += measure_time_taskflow_graph(num_threads).count();
+      }
+      else if(model == "tbb") {
+        runtime += measure_time_tbb(num_threads).count();
+      }
+      else if(model == "omp") {
+        runtime += measure_time_omp(num_threads).count();
+      }
+      else assert(false);
+    }
+
+    // average latency of one loop in microseconds
+    std::cout << std::setw(12) << N
+              << std::setw(12) << runtime / num_rounds / num_calls
+              << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  CLI::App app{"ParallelForLatency"};
+
+  unsigned num_threads {1}; 
+  app.add_option("-t,--num_threads", num_threads, "number of threads (default=1)");
+
+  unsigned num_rounds {1};  
+  app.add_option("-r,--num_rounds", num_rounds, "number of rounds (default=1)");
+  
+  size_t max_size {100000};  
+  app.add_option("-n,--max_size", max_size, "maximum number of elements (default=100000)");
+  
+  app.add_option("-c,--num_calls", num_calls, "number of loops per round (default=1000)");
+
+  std::string model = "tf";
+  app.add_option("-m,--model", model, "model name tbb|omp|tf|tfg (default=tf)")
+     ->check([] (const std::string& m) {
+        if(m != "tbb" && m != "tf" && m != "omp" && m != "tfg") {
+          return "model name should be \"tbb\", \"omp\", \"tf\", or \"tfg\"";
+        }
+        return "";
+     });
+
+  CLI11_PARSE(app, argc, argv);
+   
+  std::cout << "model=" << model << ' '
+            << "num_threads=" << num_threads << ' '
+            << "num_rounds=" << num_rounds << ' '
+            << "num_calls=" << num_calls << ' '
+            << std::endl;
+
+  parallel_for_latency(model, max_size, num_threads, num_rounds);
+
+  return 0;
+}
@@ -0,0 +1,23 @@
+#include "parallel_for_latency.hpp"
+#include <omp.h>
+
+// parallel_for_latency_omp
+void parallel_for_latency_omp() {
+  const long N = static_cast<long>(data.size());
+  #pragma omp parallel for schedule(guided)
+  for(long i=0; i<N; i++) {
+    data[i] = work(data[i]);
+  }
+}
+
+std::chrono::microseconds measure_time_omp(unsigned num_threads) {
+  
+  omp_set_num_threads(num_threads);
+
+  auto beg = std::chrono::high_resolution_clock::now();
+  for(size_t i=0; i<num_calls; i++) {
+    parallel_for_latency_omp();
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
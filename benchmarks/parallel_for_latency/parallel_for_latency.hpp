@@ -0,0 +1,30 @@
+#include <algorithm> 
+#include <cassert>
+#include <cstdio>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <random>
+#include <cmath>
+#include <atomic>
+#include <string>
+#include <vector>
+
+inline std::vector<double> data;
+
+// number of back-to-back loops over data to time
+inline size_t num_calls = 1000;
+
+// work done on every element
+inline double work(double x) {
+  for(int i=0; i<16; i++) {
+    x = std::sqrt(x * x + 1.0);
+  }
+  return x;
+}
+
+std::chrono::microseconds measure_time_taskflow(unsigned);
+std::chrono::microseconds measure_time_taskflow_graph(unsigned);
+std::chrono::microseconds measure_time_tbb(unsigned);
+std::chrono::microseconds measure_time_omp(unsigned);
@@ -0,0 +1,43 @@
+#include "parallel_for_latency.hpp"
+#include <taskflow/taskflow.hpp> 
+
+// the executor outlives all loops, as in an application issuing 
+// many small loops
+tf::Executor& executor(unsigned num_threads) {
+  static tf::Executor executor(num_threads);
+  return executor;
+}
+
+// parallel_for_latency_taskflow
+void parallel_for_latency_taskflow(unsigned num_threads) {
+  executor(num_threads).parallel_for(data.begin(), data.end(), [](double& d){
+    d = work(d);
+  });
+}
+
+// parallel_for_latency_taskflow_graph
+void parallel_for_latency_taskflow_graph(unsigned num_threads) {
+  tf::Taskflow taskflow;
+  taskflow.for_each(data.begin(), data.end(), [](double& d){
+    d = work(d);
+  });
+  executor(num_threads).run(taskflow).wait();
+}
+
+std::chrono::microseconds measure_time_taskflow(unsigned num_threads) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  for(size_t i=0; i<num_calls; i++) {
+    parallel_for_latency_taskflow(num_threads);
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
+std::chrono::microseconds measure_time_taskflow_graph(unsigned num_threads) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  for(size_t i=0; i<num_calls; i++) {
+    parallel_for_latency_taskflow_graph(num_threads);
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
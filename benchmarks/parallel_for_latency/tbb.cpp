@@ -0,0 +1,24 @@
+#include "parallel_for_latency.hpp"
+#include <tbb/parallel_for.h>
+#include <tbb/global_control.h>
+
+// parallel_for_latency_tbb
+void parallel_for_latency_tbb() {
+  tbb::parallel_for(size_t{0}, data.size(), [](size_t i){
+    data[i] = work(data[i]);
+  });
+}
+
+std::chrono::microseconds measure_time_tbb(unsigned num_threads) {
+  
+  tbb::global_control c(
+    tbb::global_control::max_allowed_parallelism, num_threads
+  );
+
+  auto beg = std::chrono::high_resolution_clock::now();
+  for(size_t i=0; i<num_calls; i++) {
+    parallel_for_latency_tbb();
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
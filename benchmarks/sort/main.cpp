@@ -41,6 +41,62 @@ void reduce_sum(
   }
 }
 
+// runtime of sorting a fixed-size input over an increasing number of threads
+void sort_scaling(
+  const std::string& model,
+  const unsigned max_threads, 
+  const unsigned num_rounds,
+  const size_t N
+  ) {
+
+  std::cout << std::setw(12) << "threads"
+            << std::setw(12) << "runtime"
+            << std::setw(12) << "speedup"
+            << std::endl;
+
+  vec.resize(N);
+
+  double baseline {0.0};
+
+  for(unsigned num_threads=1; num_threads<=max_threads; num_threads*=2) {
+
+    double runtime {0.0};
+
+    for(unsigned j=0; j<num_rounds; ++j) {
+      
+      for(auto& d : vec) {
+        d = ::rand();
+      }
+
+      if(model == "tf") {
+        runtime += measure_time_taskflow(num_threads).count();
+      }
+      else if(model == "tbb") {
+        runtime += measure_time_tbb(num_threads).count();
+      }
+      else if(model == "omp") {
+        runtime += measure_time_omp(num_threads).count();
+      }
+      else assert(false);
+    }
+
+    runtime = runtime / num_rounds / 1e3;
+
+    if(num_threads == 1) {
+      baseline = runtime;
+    }
+
+    std::cout << std::setw(12) << num_threads
+              << std::setw(12) << runtime
+              << std::setw(12) << baseline / runtime
+              << std::endl;
+
+    if(num_threads < max_threads && num_threads*2 > max_threads) {
+      num_threads = max_threads / 2;
+    }
+  }
+}
+
 int main(int argc, char* argv[]) {
 
   CLI::App app{"MatrixMultiplication"};
@@ -60,6 +116,12 @@ int main(int argc, char* argv[]) {
         return "";
      });
 
+  size_t scaling {0};
+  app.add_option(
+    "-s,--scaling", scaling, 
+    "sorts this many elements using 1 to num_threads threads (default=0, off)"
+  );
+
   CLI11_PARSE(app, argc, argv);
    
   std::cout << "model=" << model << ' '
@@ -67,7 +129,12 @@ int main(int argc, char* argv[]) {
             << "num_rounds=" << num_rounds << ' '
             << std::endl;
 
-  reduce_sum(model, num_threads, num_rounds);
+  if(scaling) {
+    sort_scaling(model, num_threads, num_rounds, scaling);
+  }
+  else {
+    reduce_sum(model, num_threads, num_rounds);
+  }
 
   return 0;
 }
@@ -81,6 +81,7 @@ inline void framework_computation(int i, int j){
 
 
 std::chrono::microseconds measure_time_taskflow(unsigned);
+std::chrono::microseconds measure_time_taskflow_wavefront(unsigned);
 std::chrono::microseconds measure_time_omp(unsigned);
 std::chrono::microseconds measure_time_tbb(unsigned);
 
@@ -40,3 +40,25 @@ std::chrono::microseconds measure_time_taskflow(unsigned num_threads) {
 }
 
 
+// wavefront computing with tf::Taskflow::wavefront
+void wavefront_taskflow_primitive(unsigned num_threads) {
+  
+  tf::Executor executor(num_threads);
+  tf::Taskflow taskflow;
+
+  matrix[M-1][N-1] = 0;
+
+  taskflow.wavefront(MB, NB, [](int i, int j) {
+    block_computation(i, j);
+  });
+
+  executor.run(taskflow).get();
+}
+
+std::chrono::microseconds measure_time_taskflow_wavefront(unsigned num_threads) {
+  auto beg = std::chrono::high_resolution_clock::now();
+  wavefront_taskflow_primitive(num_threads);
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - beg);
+}
+
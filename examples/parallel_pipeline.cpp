@@ -0,0 +1,77 @@
+// This program demonstrates how to create a pipeline scheduling framework
+// that propagates a series of integers and adds one to the result at each
+// stage, using tf::Pipeline.
+//
+// The pipeline has the following structure:
+//
+// o -> o -> o
+// |    |    |
+// v    v    v
+// o -> o -> o
+// |    |    |
+// v    v    v
+// o -> o -> o
+// |    |    |
+// v    v    v
+// o -> o -> o
+#include <taskflow/taskflow.hpp>
+
+int main() {
+
+  tf::Taskflow taskflow("pipeline");
+  tf::Executor executor;
+
+  const size_t num_lines = 4;
+  const size_t num_pipes = 3;
+
+  // custom data storage
+  std::array<std::array<int, num_pipes>, num_lines> buffer;
+
+  // the pipeline consists of three pipes (serial-parallel-serial)
+  // and up to four concurrent scheduling tokens
+  tf::Pipeline pl(num_lines,
+    tf::Pipe{tf::PipeType::SERIAL, [&buffer](tf::Pipeflow& pf) {
+      // generate only 5 scheduling tokens
+      if(pf.token() == 5) {
+        pf.stop();
+      }
+      // save the token id into the buffer
+      else {
+        buffer[pf.line()][pf.pipe()] = pf.token();
+      }
+    }},
+
+    tf::Pipe{tf::PipeType::PARALLEL, [&buffer](tf::Pipeflow& pf) {
+      // propagate the previous result to this pipe and increment
+      // it by one
+      buffer[pf.line()][pf.pipe()] = buffer[pf.line()][pf.pipe()-1] + 1;
+    }},
+
+    tf::Pipe{tf::PipeType::SERIAL, [&buffer](tf::Pipeflow& pf) {
+      // propagate the previous result to this pipe and increment
+      // it by one
+      buffer[pf.line()][pf.pipe()] = buffer[pf.line()][pf.pipe()-1] + 1;
+      printf(
+        "token %zu finished on line %zu with %d\n", 
+        pf.token(), pf.line(), buffer[pf.line()][pf.pipe()]
+      );
+    }}
+  );
+
+  // build the pipeline graph
+  tf::Task init = taskflow.emplace([](){ std::cout << "ready\n"; })
+                          .name("starting pipeline");
+  tf::Task task = taskflow.pipeline(pl)
+                          .name("pipeline");
+  tf::Task stop = taskflow.emplace([](){ std::cout << "stopped\n"; })
+                          .name("pipeline stopped");
+
+  // create task dependency
+  init.precede(task);
+  task.precede(stop);
+
+  // run the pipeline
+  executor.run(taskflow).wait();
+
+  return 0;
+}
@@ -0,0 +1,408 @@
+#pragma once
+
+#include "../executor.hpp"
+
+namespace tf {
+
+// threshold whether or not to perform parallel compaction
+template <typename I>
+constexpr size_t parallel_compact_cutoff() {
+
+  using value_type = typename std::iterator_traits<I>::value_type;
+
+  constexpr size_t object_size = sizeof(value_type);
+
+  if constexpr(object_size < 16) return 4096;
+  else if constexpr(object_size < 32) return 2048;
+  else if constexpr(object_size < 64) return 1024;
+  else if constexpr(object_size < 128) return 768;
+  else if constexpr(object_size < 256) return 512;
+  else if constexpr(object_size < 512) return 256;
+  else return 128;
+}
+
+// ----------------------------------------------------------------------------
+// parallel compaction
+// ----------------------------------------------------------------------------
+
+// Shared state of compacting [beg, beg + N) in parallel.
+// The range is split into one contiguous block per worker. Each block first
+// flags and counts its selected elements, a scan over the block counts gives
+// the output offset of every block, and the blocks then scatter their
+// selected elements to the output in parallel.
+template <typename I>
+struct ParallelCompaction {
+
+  using value_type = typename std::iterator_traits<I>::value_type;
+
+  ParallelCompaction(I b, size_t n, size_t B) :
+    beg {b}, N {n}, bounds(B + 1), offsets(B + 1, 0), flags(n) {
+    for(size_t i=0; i<=B; i++) {
+      bounds[i] = i * N / B;
+    }
+  }
+
+  ~ParallelCompaction() {
+    if(buffer) {
+      std::allocator<value_type>{}.deallocate(buffer, buffer_size);
+    }
+  }
+
+  I beg;
+  size_t N;
+
+  std::vector<size_t> bounds;         // block boundaries
+  std::vector<size_t> offsets;        // output offsets of blocks
+  std::vector<unsigned char> flags;   // selection flags of elements
+
+  value_type* buffer {nullptr};       // uninitialized staging storage
+  size_t buffer_size {0};
+
+  std::atomic<size_t> pending {0};
+
+  size_t num_blocks() const { return bounds.size() - 1; }
+  size_t num_selected() const { return offsets.back(); }
+
+  void allocate(size_t n) {
+    buffer = std::allocator<value_type>{}.allocate(n);
+    buffer_size = n;
+  }
+};
+
+// Procedure: parallel_compact_phase
+// runs f(b) on every block b in parallel and then calls g() from the
+// task that finishes last
+template <typename I, typename F, typename G>
+void parallel_compact_phase(
+  Subflow& sf, std::shared_ptr<ParallelCompaction<I>> pc, F f, G g
+) {
+
+  const size_t B = pc->num_blocks();
+
+  pc->pending.store(B, std::memory_order_relaxed);
+
+  for(size_t b=0; b<B; b++) {
+    sf.silent_async([pc, b, f, g] () mutable {
+      f(b);
+      if(pc->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        g();
+      }
+    });
+  }
+}
+
+// Procedure: parallel_compact
+// flags every element i for which sel(i) is true, computes the output
+// offset of every block, and then calls g()
+template <typename I, typename S, typename G>
+void parallel_compact(
+  Subflow& sf, std::shared_ptr<ParallelCompaction<I>> pc, S sel, G g
+) {
+  parallel_compact_phase(sf, pc,
+    [pc, sel] (size_t b) mutable {
+      size_t n = 0;
+      for(size_t i=pc->bounds[b]; i<pc->bounds[b+1]; i++) {
+        n += (pc->flags[i] = sel(i) ? 1 : 0);
+      }
+      pc->offsets[b+1] = n;
+    },
+    [pc, g] () mutable {
+      // exclusive scan of the block counts
+      std::partial_sum(pc->offsets.begin(), pc->offsets.end(), pc->offsets.begin());
+      g();
+    }
+  );
+}
+
+// Procedure: parallel_compact_in_place
+// moves the flagged elements to the front of the range, preserving their
+// relative order
+template <typename I>
+void parallel_compact_in_place(
+  Subflow& sf, std::shared_ptr<ParallelCompaction<I>> pc
+) {
+
+  using T = typename ParallelCompaction<I>::value_type;
+
+  if(pc->num_selected() == 0) {
+    return;
+  }
+
+  // Blocks cannot move their elements straight to their final positions,
+  // which may still be read by the preceding blocks. Selected elements are
+  // staged in a buffer instead, except for the leading blocks whose output
+  // stays within the block itself.
+  pc->allocate(pc->num_selected());
+
+  parallel_compact_phase(sf, pc,
+    [pc] (size_t b) {
+      size_t o = pc->offsets[b];
+      if(o == pc->bounds[b]) {
+        for(size_t i=pc->bounds[b]; i<pc->bounds[b+1]; i++) {
+          if(pc->flags[i]) {
+            if(i != o) {
+              pc->beg[o] = std::move(pc->beg[i]);
+            }
+            ++o;
+          }
+        }
+      }
+      else {
+        for(size_t i=pc->bounds[b]; i<pc->bounds[b+1]; i++) {
+          if(pc->flags[i]) {
+            ::new (static_cast<void*>(pc->buffer + o++)) T(std::move(pc->beg[i]));
+          }
+        }
+      }
+    },
+    [&sf, pc] () {
+      parallel_compact_phase(sf, pc,
+        [pc] (size_t b) {
+          if(pc->offsets[b] == pc->bounds[b]) {
+            return;
+          }
+          for(size_t o=pc->offsets[b]; o<pc->offsets[b+1]; o++) {
+            pc->beg[o] = std::move(pc->buffer[o]);
+            std::destroy_at(pc->buffer + o);
+          }
+        },
+        [] () {}
+      );
+    }
+  );
+}
+
+// ----------------------------------------------------------------------------
+// tf::Taskflow::copy_if
+// ----------------------------------------------------------------------------
+
+// Function: copy_if
+template <typename B, typename E, typename D, typename P, typename R>
+Task FlowBuilder::copy_if(B&& beg, E&& end, D&& d_beg, P pred, R& result) {
+
+  using I = stateful_iterator_t<B, E>;
+  using O = stateful_iterator_t<D, D>;
+
+  Task task = emplace(
+  [b=std::forward<B>(beg), e=std::forward<E>(end), d=std::forward<D>(d_beg),
+   pred, &r=result] (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    I beg = b;
+    I end = e;
+    O out = d;
+
+    size_t W = sf._executor.num_workers();
+    size_t N = std::distance(beg, end);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1 || N <= parallel_compact_cutoff<I>()) {
+      r = std::copy_if(beg, end, out, pred);
+      return;
+    }
+
+    auto pc = std::make_shared<ParallelCompaction<I>>(
+      beg, N, std::min(W, N / parallel_compact_cutoff<I>())
+    );
+
+    parallel_compact(sf, pc,
+      [beg, pred] (size_t i) mutable { return pred(beg[i]); },
+      [&sf, &r, pc, out] () {
+        r = out + pc->num_selected();
+        parallel_compact_phase(sf, pc,
+          [pc, out] (size_t b) {
+            auto d = out + pc->offsets[b];
+            for(size_t i=pc->bounds[b]; i<pc->bounds[b+1]; i++) {
+              if(pc->flags[i]) {
+                *d++ = pc->beg[i];
+              }
+            }
+          },
+          [] () {}
+        );
+      }
+    );
+
+    sf.join();
+  });
+
+  return task;
+}
+
+// ----------------------------------------------------------------------------
+// tf::Taskflow::remove_if
+// ----------------------------------------------------------------------------
+
+// Function: remove_if
+template <typename B, typename E, typename P, typename R>
+Task FlowBuilder::remove_if(B&& beg, E&& end, P pred, R& result) {
+
+  using I = stateful_iterator_t<B, E>;
+
+  Task task = emplace(
+  [b=std::forward<B>(beg), e=std::forward<E>(end), pred, &r=result]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    I beg = b;
+    I end = e;
+
+    size_t W = sf._executor.num_workers();
+    size_t N = std::distance(beg, end);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1 || N <= parallel_compact_cutoff<I>()) {
+      r = std::remove_if(beg, end, pred);
+      return;
+    }
+
+    auto pc = std::make_shared<ParallelCompaction<I>>(
+      beg, N, std::min(W, N / parallel_compact_cutoff<I>())
+    );
+
+    parallel_compact(sf, pc,
+      [beg, pred] (size_t i) mutable { return !pred(beg[i]); },
+      [&sf, &r, pc] () {
+        r = pc->beg + pc->num_selected();
+        parallel_compact_in_place(sf, pc);
+      }
+    );
+
+    sf.join();
+  });
+
+  return task;
+}
+
+// ----------------------------------------------------------------------------
+// tf::Taskflow::unique
+// ----------------------------------------------------------------------------
+
+// Function: unique
+template <typename B, typename E, typename P, typename R>
+Task FlowBuilder::unique(B&& beg, E&& end, P pred, R& result) {
+
+  using I = stateful_iterator_t<B, E>;
+
+  Task task = emplace(
+  [b=std::forward<B>(beg), e=std::forward<E>(end), pred, &r=result]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    I beg = b;
+    I end = e;
+
+    size_t W = sf._executor.num_workers();
+    size_t N = std::distance(beg, end);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1 || N <= parallel_compact_cutoff<I>()) {
+      r = std::unique(beg, end, pred);
+      return;
+    }
+
+    auto pc = std::make_shared<ParallelCompaction<I>>(
+      beg, N, std::min(W, N / parallel_compact_cutoff<I>())
+    );
+
+    // keeps the first element of every group of equivalent neighbors
+    parallel_compact(sf, pc,
+      [beg, pred] (size_t i) mutable {
+        return i == 0 || !pred(beg[i-1], beg[i]);
+      },
+      [&sf, &r, pc] () {
+        r = pc->beg + pc->num_selected();
+        parallel_compact_in_place(sf, pc);
+      }
+    );
+
+    sf.join();
+  });
+
+  return task;
+}
+
+// Function: unique
+template <typename B, typename E, typename R>
+Task FlowBuilder::unique(B&& beg, E&& end, R& result) {
+
+  using I = stateful_iterator_t<B, E>;
+  using value_type = typename std::iterator_traits<I>::value_type;
+
+  return unique(
+    std::forward<B>(beg), std::forward<E>(end), std::equal_to<value_type>{},
+    result
+  );
+}
+
+// ----------------------------------------------------------------------------
+// tf::Taskflow::partition
+// ----------------------------------------------------------------------------
+
+// Function: partition
+template <typename B, typename E, typename P, typename R>
+Task FlowBuilder::partition(B&& beg, E&& end, P pred, R& result) {
+
+  using I = stateful_iterator_t<B, E>;
+  using T = typename std::iterator_traits<I>::value_type;
+
+  Task task = emplace(
+  [b=std::forward<B>(beg), e=std::forward<E>(end), pred, &r=result]
+  (Subflow& sf) mutable {
+
+    // fetch the iterator values
+    I beg = b;
+    I end = e;
+
+    size_t W = sf._executor.num_workers();
+    size_t N = std::distance(beg, end);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1 || N <= parallel_compact_cutoff<I>()) {
+      r = std::stable_partition(beg, end, pred);
+      return;
+    }
+
+    auto pc = std::make_shared<ParallelCompaction<I>>(
+      beg, N, std::min(W, N / parallel_compact_cutoff<I>())
+    );
+
+    // scatters both the selected and the rejected elements to the buffer
+    // and moves them back afterwards
+    parallel_compact(sf, pc,
+      [beg, pred] (size_t i) mutable { return pred(beg[i]); },
+      [&sf, &r, pc] () {
+        r = pc->beg + pc->num_selected();
+        pc->allocate(pc->N);
+        parallel_compact_phase(sf, pc,
+          [pc] (size_t b) {
+            size_t t = pc->offsets[b];
+            size_t f = pc->num_selected() + pc->bounds[b] - pc->offsets[b];
+            for(size_t i=pc->bounds[b]; i<pc->bounds[b+1]; i++) {
+              size_t o = pc->flags[i] ? t++ : f++;
+              ::new (static_cast<void*>(pc->buffer + o)) T(std::move(pc->beg[i]));
+            }
+          },
+          [&sf, pc] () {
+            parallel_compact_phase(sf, pc,
+              [pc] (size_t b) {
+                for(size_t i=pc->bounds[b]; i<pc->bounds[b+1]; i++) {
+                  pc->beg[i] = std::move(pc->buffer[i]);
+                  std::destroy_at(pc->buffer + i);
+                }
+              },
+              [] () {}
+            );
+          }
+        );
+      }
+    );
+
+    sf.join();
+  });
+
+  return task;
+}
+
+}  // namespace tf ------------------------------------------------------------
+
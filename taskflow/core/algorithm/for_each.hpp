@@ -12,6 +12,41 @@ namespace tf {
 // default parallel for
 // ----------------------------------------------------------------------------
 
+// Function: split_forward_range
+// splits [beg, end) into at least K (unless the range is shorter) and 
+// at most 2K chunks of equal size in one pass and returns the chunk 
+// boundaries, including end
+template <typename I>
+std::vector<I> split_forward_range(I beg, I end, size_t K) {
+
+  std::vector<I> bounds;
+  bounds.reserve(2*K + 2);
+  bounds.push_back(beg);
+
+  size_t s = 1;   // chunk size
+  size_t n = 0;   // number of elements since the last boundary
+
+  while(beg != end) {
+    ++beg;
+    if(++n == s && beg != end) {
+      bounds.push_back(beg);
+      n = 0;
+      // merges every two chunks into one
+      if(bounds.size() > 2*K) {
+        for(size_t i=1; 2*i<bounds.size(); i++) {
+          bounds[i] = bounds[2*i];
+        }
+        bounds.resize((bounds.size() + 1) / 2);
+        s *= 2;
+      }
+    }
+  }
+
+  bounds.push_back(end);
+
+  return bounds;
+}
+
 // Function: for_each
 template <typename B, typename E, typename C>
 Task FlowBuilder::for_each(B&& beg, E&& end, C c) {
@@ -20,7 +55,7 @@ Task FlowBuilder::for_each(B&& beg, E&& end, C c) {
   using namespace std::string_literals;
 
   Task task = emplace(
-  [b=std::forward<B>(beg), e=std::forward<E>(end), c] (Subflow& sf) mutable {
+  [b=std::forward<B>(beg), e=std::forward<E>(end), c] (Runtime& rt) mutable {
     
     // fetch the stateful values
     I beg = b;
@@ -31,7 +66,47 @@ Task FlowBuilder::for_each(B&& beg, E&& end, C c) {
     }
   
     size_t chunk_size = 1;
-    size_t W = sf._executor.num_workers();
+    size_t W = rt.executor().num_workers();
+
+    // Without random access, advancing to a claimed chunk walks the range
+    // from the previous position of the worker. Instead, the range is split 
+    // into chunks in one pass and workers claim whole chunks.
+    if constexpr(!std::is_base_of_v<
+      std::random_access_iterator_tag, 
+      typename std::iterator_traits<I>::iterator_category
+    >) {
+      
+      if(W <= 1) {
+        std::for_each(beg, end, c);
+        return;
+      }
+
+      auto bounds = split_forward_range(beg, end, 4*W);
+      
+      size_t N = bounds.size() - 1;
+
+      if(N <= chunk_size) {
+        std::for_each(beg, end, c);
+        return;
+      }
+
+      if(N < W) {
+        W = N;
+      }
+
+      std::atomic<size_t> next(0);
+
+      auto loop = [&next, &bounds, N, c] () mutable {
+        size_t x;
+        while((x = next.fetch_add(1, std::memory_order_relaxed)) < N) {
+          std::for_each(bounds[x], bounds[x+1], c);
+        }
+      };
+
+      corun_loop(rt, W, loop);
+      return;
+    }
+
     size_t N = std::distance(beg, end);
     
     // only myself - no need to spawn another graph
@@ -46,59 +121,54 @@ Task FlowBuilder::for_each(B&& beg, E&& end, C c) {
 
     std::atomic<size_t> next(0);
 
-    for(size_t w=0; w<W; w++) {
+    auto loop = [&next, beg, N, chunk_size, W, c] () mutable {
+      
+      size_t z = 0;
+      size_t p1 = 2 * W * (chunk_size + 1);
+      double p2 = 0.5 / static_cast<double>(W);
+      size_t s0 = next.load(std::memory_order_relaxed);
 
-      //sf.emplace([&next, beg, N, chunk_size, W, c] () mutable {
-      sf.silent_async([&next, beg, N, chunk_size, W, c] () mutable {
+      while(s0 < N) {
         
-        size_t z = 0;
-        size_t p1 = 2 * W * (chunk_size + 1);
-        double p2 = 0.5 / static_cast<double>(W);
-        size_t s0 = next.load(std::memory_order_relaxed);
-
-        while(s0 < N) {
-          
-          size_t r = N - s0;
-          
-          // fine-grained
-          if(r < p1) {
-            while(1) {
-              s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
-              if(s0 >= N) {
-                return;
-              }
-              size_t e0 = (chunk_size <= (N - s0)) ? s0 + chunk_size : N;
-              std::advance(beg, s0-z);
-              for(size_t x=s0; x<e0; x++) {
-                c(*beg++);
-              }
-              z = e0;
+        size_t r = N - s0;
+        
+        // fine-grained
+        if(r < p1) {
+          while(1) {
+            s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
+            if(s0 >= N) {
+              return;
             }
-            break;
-          }
-          // coarse-grained
-          else {
-            size_t q = static_cast<size_t>(p2 * r);
-            if(q < chunk_size) {
-              q = chunk_size;
+            size_t e0 = (chunk_size <= (N - s0)) ? s0 + chunk_size : N;
+            std::advance(beg, s0-z);
+            for(size_t x=s0; x<e0; x++) {
+              c(*beg++);
             }
-            size_t e0 = (q <= r) ? s0 + q : N;
-            if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
-                                                    std::memory_order_relaxed)) {
-              std::advance(beg, s0-z);
-              for(size_t x = s0; x< e0; x++) {
-                c(*beg++);
-              }
-              z = e0;
-              s0 = next.load(std::memory_order_relaxed);
+            z = e0;
+          }
+          break;
+        }
+        // coarse-grained
+        else {
+          size_t q = static_cast<size_t>(p2 * r);
+          if(q < chunk_size) {
+            q = chunk_size;
+          }
+          size_t e0 = (q <= r) ? s0 + q : N;
+          if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
+                                                  std::memory_order_relaxed)) {
+            std::advance(beg, s0-z);
+            for(size_t x = s0; x< e0; x++) {
+              c(*beg++);
             }
+            z = e0;
+            s0 = next.load(std::memory_order_relaxed);
           }
         }
-      //}).name("pfg_"s + std::to_string(w));
-      });
-    }
-    
-    sf.join();
+      }
+    };
+
+    corun_loop(rt, W, loop);
   });  
 
   return task;
@@ -113,7 +183,7 @@ Task FlowBuilder::for_each_index(B&& beg, E&& end, S&& inc, C c){
 
   Task task = emplace(
   [b=std::forward<B>(beg), e=std::forward<E>(end), a=std::forward<S>(inc), c] 
-  (Subflow& sf) mutable {
+  (Runtime& rt) mutable {
     
     // fetch the iterator values
     I beg = b;
@@ -125,7 +195,7 @@ Task FlowBuilder::for_each_index(B&& beg, E&& end, S&& inc, C c){
     }
     
     size_t chunk_size = 1;
-    size_t W = sf._executor.num_workers();
+    size_t W = rt.executor().num_workers();
     size_t N = distance(beg, end, inc);
     
     // only myself - no need to spawn another graph
@@ -142,33 +212,476 @@ Task FlowBuilder::for_each_index(B&& beg, E&& end, S&& inc, C c){
     
     std::atomic<size_t> next(0);
 
-    for(size_t w=0; w<W; w++) {
+    auto loop = [&next, beg, inc, N, chunk_size, W, c] () mutable {
+      
+      size_t p1 = 2 * W * (chunk_size + 1);
+      double p2 = 0.5 / static_cast<double>(W);
+      size_t s0 = next.load(std::memory_order_relaxed);
 
-      //sf.emplace([&next, beg, inc, N, chunk_size, W, c] () mutable {
-      sf.silent_async([&next, beg, inc, N, chunk_size, W, c] () mutable {
+      while(s0 < N) {
+      
+        size_t r = N - s0;
         
-        size_t p1 = 2 * W * (chunk_size + 1);
-        double p2 = 0.5 / static_cast<double>(W);
-        size_t s0 = next.load(std::memory_order_relaxed);
+        // find-grained
+        if(r < p1) {
+          while(1) { 
+            s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
+            if(s0 >= N) {
+              return;
+            }
+            size_t e0 = (chunk_size <= (N - s0)) ? s0 + chunk_size : N;
+            auto s = static_cast<I>(s0) * inc + beg;
+            for(size_t x=s0; x<e0; x++, s+=inc) {
+              c(s);
+            }
+          }
+          break;
+        }
+        // coarse-grained
+        else {
+          size_t q = static_cast<size_t>(p2 * r);
+          if(q < chunk_size) {
+            q = chunk_size;
+          }
+          size_t e0 = (q <= r) ? s0 + q : N;
+          if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
+                                                  std::memory_order_relaxed)) {
+            auto s = static_cast<I>(s0) * inc + beg;
+            for(size_t x=s0; x<e0; x++, s+= inc) {
+              c(s);
+            }
+            s0 = next.load(std::memory_order_relaxed); 
+          }
+        }
+      } 
+    };
 
-        while(s0 < N) {
+    corun_loop(rt, W, loop);
+  });  
+
+  return task;
+}
+
+// ----------------------------------------------------------------------------
+// multidimensional parallel for
+// ----------------------------------------------------------------------------
+
+// default number of iterations per tile of a multidimensional parallel for
+constexpr size_t parallel_for_tile_size = 4096;
+
+// Procedure: morton_tiles
+// appends to tiles the tiles of the D-dimensional cube at origin o with 
+// edge length n (a power of two) that lie inside the given grid, 
+// in Morton (Z) order
+template <size_t D>
+void morton_tiles(
+  std::vector<std::array<size_t, D>>& tiles, 
+  const std::array<size_t, D>& o, 
+  size_t n, 
+  const std::array<size_t, D>& grid
+) {
+
+  for(size_t d=0; d<D; d++) {
+    if(o[d] >= grid[d]) {
+      return;
+    }
+  }
+
+  if(n == 1) {
+    tiles.push_back(o);
+    return;
+  }
+
+  n >>= 1;
+
+  // the first dimension takes the most significant bit of the child index
+  for(size_t c=0; c<(size_t{1} << D); c++) {
+    auto s = o;
+    for(size_t d=0; d<D; d++) {
+      if(c & (size_t{1} << (D-1-d))) {
+        s[d] += n;
+      }
+    }
+    morton_tiles(tiles, s, n, grid);
+  }
+}
+
+// Procedure: parallel_for_each_tile
+// applies visit to every tile of the given grid in parallel, claiming 
+// tiles in Morton order with guided scheduling
+template <size_t D, typename V>
+void parallel_for_each_tile(
+  Runtime& rt, size_t W, const std::array<size_t, D>& grid, V visit
+) {
+  
+  size_t n = 1;
+  size_t T = 1;
+  for(size_t d=0; d<D; d++) {
+    n = std::max(n, grid[d]);
+    T *= grid[d];
+  }
+  
+  if(T == 0) {
+    return;
+  }
+
+  std::vector<std::array<size_t, D>> tiles;
+  tiles.reserve(T);
+  morton_tiles<D>(tiles, {}, next_pow2(n), grid);
+  
+  size_t chunk_size = 1;
+  size_t N = tiles.size();
+  
+  // only myself - no need to spawn another graph
+  if(W <= 1 || N <= chunk_size) {
+    for(const auto& tile : tiles) {
+      visit(tile);
+    }
+    return;
+  }
+  
+  if(N < W) {
+    W = N;
+  }
+  
+  std::atomic<size_t> next(0);
+
+  auto loop = [&next, &tiles, N, chunk_size, W, visit] () mutable {
+    
+    size_t p1 = 2 * W * (chunk_size + 1);
+    double p2 = 0.5 / static_cast<double>(W);
+    size_t s0 = next.load(std::memory_order_relaxed);
+
+    while(s0 < N) {
+    
+      size_t r = N - s0;
+      
+      // fine-grained
+      if(r < p1) {
+        while(1) { 
+          s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
+          if(s0 >= N) {
+            return;
+          }
+          size_t e0 = (chunk_size <= (N - s0)) ? s0 + chunk_size : N;
+          for(size_t x=s0; x<e0; x++) {
+            visit(tiles[x]);
+          }
+        }
+        break;
+      }
+      // coarse-grained
+      else {
+        size_t q = static_cast<size_t>(p2 * r);
+        if(q < chunk_size) {
+          q = chunk_size;
+        }
+        size_t e0 = (q <= r) ? s0 + q : N;
+        if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
+                                                std::memory_order_relaxed)) {
+          for(size_t x=s0; x<e0; x++) {
+            visit(tiles[x]);
+          }
+          s0 = next.load(std::memory_order_relaxed); 
+        }
+      }
+    } 
+  };
+
+  corun_loop(rt, W, loop);
+}
+
+// Function: for_each_index_2d
+template <
+  typename B0, typename E0, typename B1, typename E1, typename C
+>
+Task FlowBuilder::for_each_index_2d(
+  B0&& beg0, E0&& end0, B1&& beg1, E1&& end1, 
+  size_t tile0, size_t tile1, C c
+) {
+
+  using I0 = stateful_index_t<B0, E0, E0>;
+  using I1 = stateful_index_t<B1, E1, E1>;
+
+  Task task = emplace(
+  [b0=std::forward<B0>(beg0), e0=std::forward<E0>(end0), 
+   b1=std::forward<B1>(beg1), e1=std::forward<E1>(end1), tile0, tile1, c] 
+  (Runtime& rt) mutable {
+
+    // fetch the index values
+    I0 beg0 = b0;
+    I0 end0 = e0;
+    I1 beg1 = b1;
+    I1 end1 = e1;
+
+    if(beg0 > end0 || beg1 > end1 || tile0 == 0 || tile1 == 0) {
+      TF_THROW(
+        "invalid range [", beg0, ", ", end0, ") x [", beg1, ", ", end1, 
+        ") with tile size ", tile0, " x ", tile1
+      );
+    }
+
+    size_t N0 = static_cast<size_t>(end0 - beg0);
+    size_t N1 = static_cast<size_t>(end1 - beg1);
+    
+    size_t W = rt.executor().num_workers();
+    
+    std::array<size_t, 2> grid {
+      (N0 + tile0 - 1) / tile0, (N1 + tile1 - 1) / tile1
+    };
+
+    parallel_for_each_tile<2>(rt, W, grid, 
+      [=] (const std::array<size_t, 2>& t) mutable {
+        I0 i0 = beg0 + static_cast<I0>(t[0] * tile0);
+        I1 i1 = beg1 + static_cast<I1>(t[1] * tile1);
+        I0 l0 = (end0 - i0 <= static_cast<I0>(tile0)) ? end0 : i0 + static_cast<I0>(tile0);
+        I1 l1 = (end1 - i1 <= static_cast<I1>(tile1)) ? end1 : i1 + static_cast<I1>(tile1);
+        for(I0 i=i0; i<l0; i++) {
+          for(I1 j=i1; j<l1; j++) {
+            c(i, j);
+          }
+        }
+      }
+    );
+  });
+
+  return task;
+}
+
+// Function: for_each_index_2d
+template <
+  typename B0, typename E0, typename B1, typename E1, typename C
+>
+Task FlowBuilder::for_each_index_2d(
+  B0&& beg0, E0&& end0, B1&& beg1, E1&& end1, C c
+) {
+  return for_each_index_2d(
+    std::forward<B0>(beg0), std::forward<E0>(end0),
+    std::forward<B1>(beg1), std::forward<E1>(end1),
+    64, parallel_for_tile_size / 64, c
+  );
+}
+
+// Function: for_each_index_3d
+template <
+  typename B0, typename E0, typename B1, typename E1, 
+  typename B2, typename E2, typename C
+>
+Task FlowBuilder::for_each_index_3d(
+  B0&& beg0, E0&& end0, B1&& beg1, E1&& end1, B2&& beg2, E2&& end2,
+  size_t tile0, size_t tile1, size_t tile2, C c
+) {
+
+  using I0 = stateful_index_t<B0, E0, E0>;
+  using I1 = stateful_index_t<B1, E1, E1>;
+  using I2 = stateful_index_t<B2, E2, E2>;
+
+  Task task = emplace(
+  [b0=std::forward<B0>(beg0), e0=std::forward<E0>(end0), 
+   b1=std::forward<B1>(beg1), e1=std::forward<E1>(end1), 
+   b2=std::forward<B2>(beg2), e2=std::forward<E2>(end2), 
+   tile0, tile1, tile2, c] 
+  (Runtime& rt) mutable {
+
+    // fetch the index values
+    I0 beg0 = b0;
+    I0 end0 = e0;
+    I1 beg1 = b1;
+    I1 end1 = e1;
+    I2 beg2 = b2;
+    I2 end2 = e2;
+
+    if(beg0 > end0 || beg1 > end1 || beg2 > end2 || 
+       tile0 == 0 || tile1 == 0 || tile2 == 0) {
+      TF_THROW(
+        "invalid range [", beg0, ", ", end0, ") x [", beg1, ", ", end1, 
+        ") x [", beg2, ", ", end2, ") with tile size ", 
+        tile0, " x ", tile1, " x ", tile2
+      );
+    }
+
+    size_t N0 = static_cast<size_t>(end0 - beg0);
+    size_t N1 = static_cast<size_t>(end1 - beg1);
+    size_t N2 = static_cast<size_t>(end2 - beg2);
+    
+    size_t W = rt.executor().num_workers();
+    
+    std::array<size_t, 3> grid {
+      (N0 + tile0 - 1) / tile0, (N1 + tile1 - 1) / tile1, 
+      (N2 + tile2 - 1) / tile2
+    };
+
+    parallel_for_each_tile<3>(rt, W, grid, 
+      [=] (const std::array<size_t, 3>& t) mutable {
+        I0 i0 = beg0 + static_cast<I0>(t[0] * tile0);
+        I1 i1 = beg1 + static_cast<I1>(t[1] * tile1);
+        I2 i2 = beg2 + static_cast<I2>(t[2] * tile2);
+        I0 l0 = (end0 - i0 <= static_cast<I0>(tile0)) ? end0 : i0 + static_cast<I0>(tile0);
+        I1 l1 = (end1 - i1 <= static_cast<I1>(tile1)) ? end1 : i1 + static_cast<I1>(tile1);
+        I2 l2 = (end2 - i2 <= static_cast<I2>(tile2)) ? end2 : i2 + static_cast<I2>(tile2);
+        for(I0 i=i0; i<l0; i++) {
+          for(I1 j=i1; j<l1; j++) {
+            for(I2 k=i2; k<l2; k++) {
+              c(i, j, k);
+            }
+          }
+        }
+      }
+    );
+  });
+
+  return task;
+}
+
+// Function: for_each_index_3d
+template <
+  typename B0, typename E0, typename B1, typename E1, 
+  typename B2, typename E2, typename C
+>
+Task FlowBuilder::for_each_index_3d(
+  B0&& beg0, E0&& end0, B1&& beg1, E1&& end1, B2&& beg2, E2&& end2, C c
+) {
+  return for_each_index_3d(
+    std::forward<B0>(beg0), std::forward<E0>(end0),
+    std::forward<B1>(beg1), std::forward<E1>(end1),
+    std::forward<B2>(beg2), std::forward<E2>(end2),
+    16, 16, parallel_for_tile_size / 256, c
+  );
+}
+
+// ----------------------------------------------------------------------------
+// executor-level parallel for
+// ----------------------------------------------------------------------------
+
+// Function: has_random_access
+// whether I is an index or a random-access iterator
+template <typename I>
+constexpr bool has_random_access() {
+  if constexpr(std::is_integral_v<I>) {
+    return true;
+  }
+  else {
+    return std::is_base_of_v<
+      std::random_access_iterator_tag, 
+      typename std::iterator_traits<I>::iterator_category
+    >;
+  }
+}
+
+// Procedure: _parallel_for_chunks
+// runs f(claim) on every participating thread, including the caller, 
+// where claim(b, e) assigns the next unclaimed chunk [b, e) of [first, last) 
+// and returns false once the range is exhausted
+template <typename I, typename F>
+void Executor::_parallel_for_chunks(I first, I last, size_t chunk_size, F& f) {
+
+  if(first == last) {
+    return;
+  }
+
+  if(chunk_size == 0) {
+    chunk_size = 1;
+  }
+
+  size_t W = _num_coworkers();
+
+  // only myself - the whole range is one chunk
+  auto run_serial = [&] () {
+    bool claimed = false;
+    auto l = f;
+    l([&] (I& b, I& e) {
+      if(claimed) {
+        return false;
+      }
+      b = first;
+      e = last;
+      return claimed = true;
+    });
+  };
+
+  // Without random access, advancing to a claimed chunk walks the range
+  // from the previous position of the thread. Instead, the range is split 
+  // into chunks in one pass and threads claim whole chunks.
+  if constexpr(!has_random_access<I>()) {
+    
+    if(W <= 1) {
+      run_serial();
+      return;
+    }
+
+    auto bounds = split_forward_range(first, last, 4*W);
+
+    size_t N = bounds.size() - 1;
+
+    if(N <= 1) {
+      run_serial();
+      return;
+    }
+
+    W = std::min(W, N);
+
+    std::atomic<size_t> next(0);
+
+    auto loop = [&] (size_t) {
+      auto l = f;
+      l([&next, &bounds, N] (I& b, I& e) {
+        size_t x = next.fetch_add(1, std::memory_order_relaxed);
+        if(x >= N) {
+          return false;
+        }
+        b = bounds[x];
+        e = bounds[x+1];
+        return true;
+      });
+    };
+
+    _corun_n(W, loop);
+  }
+  else {
+
+    size_t N;
+    
+    if constexpr(std::is_integral_v<I>) {
+      if(last < first) {
+        return;
+      }
+      N = static_cast<size_t>(last - first);
+    }
+    else {
+      N = std::distance(first, last);
+    }
+  
+    if(W <= 1 || N <= chunk_size) {
+      run_serial();
+      return;
+    }
+  
+    W = std::min(W, (N + chunk_size - 1) / chunk_size);
+
+    std::atomic<size_t> next(0);
+
+    // every thread claims chunks with guided scheduling
+    auto loop = [&] (size_t) {
+      
+      size_t p1 = 2 * W * (chunk_size + 1);
+      double p2 = 0.5 / static_cast<double>(W);
+      size_t s0 = next.load(std::memory_order_relaxed);
+      
+      auto l = f;
+      l([&, p1, p2, s0] (I& b, I& e) mutable {
         
+        while(s0 < N) {
+          
           size_t r = N - s0;
+          size_t e0;
           
-          // find-grained
+          // fine-grained
           if(r < p1) {
-            while(1) { 
-              s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
-              if(s0 >= N) {
-                return;
-              }
-              size_t e0 = (chunk_size <= (N - s0)) ? s0 + chunk_size : N;
-              auto s = static_cast<I>(s0) * inc + beg;
-              for(size_t x=s0; x<e0; x++, s+=inc) {
-                c(s);
-              }
+            s0 = next.fetch_add(chunk_size, std::memory_order_relaxed);
+            if(s0 >= N) {
+              return false;
             }
-            break;
+            e0 = (chunk_size <= (N - s0)) ? s0 + chunk_size : N;
           }
           // coarse-grained
           else {
@@ -176,25 +689,58 @@ Task FlowBuilder::for_each_index(B&& beg, E&& end, S&& inc, C c){
             if(q < chunk_size) {
               q = chunk_size;
             }
-            size_t e0 = (q <= r) ? s0 + q : N;
-            if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
-                                                    std::memory_order_relaxed)) {
-              auto s = static_cast<I>(s0) * inc + beg;
-              for(size_t x=s0; x<e0; x++, s+= inc) {
-                c(s);
-              }
-              s0 = next.load(std::memory_order_relaxed); 
+            e0 = (q <= r) ? s0 + q : N;
+            if(!next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
+                                                     std::memory_order_relaxed)) {
+              continue;
             }
           }
-        } 
-      //}).name("pfg_"s + std::to_string(w));
+          
+          if constexpr(std::is_integral_v<I>) {
+            b = static_cast<I>(first + static_cast<I>(s0));
+            e = static_cast<I>(first + static_cast<I>(e0));
+          }
+          else {
+            b = std::next(first, s0);
+            e = std::next(first, e0);
+          }
+          
+          s0 = e0;
+          return true;
+        }
+
+        return false;
       });
+    };
+
+    _corun_n(W, loop);
+  }
+}
+
+// Function: parallel_for
+template <typename B, typename E, typename C>
+void Executor::parallel_for(B first, E last, C callable, size_t chunk_size) {
+
+  using I = std::common_type_t<B, E>;
+  
+  // every thread runs on its own copy of the callable
+  auto f = [callable] (auto&& claim) mutable {
+    I b, e;
+    while(claim(b, e)) {
+      if constexpr(std::is_integral_v<I>) {
+        for(; b<e; ++b) {
+          callable(b);
+        }
+      }
+      else {
+        for(; b!=e; ++b) {
+          callable(*b);
+        }
+      }
     }
-    
-    sf.join();
-  });  
+  };
 
-  return task;
+  _parallel_for_chunks(I(first), I(last), chunk_size, f);
 }
 
 }  // end of namespace tf -----------------------------------------------------
@@ -0,0 +1,482 @@
+#pragma once
+
+#include "../executor.hpp"
+
+/**
+@file pipeline.hpp
+@brief pipeline include file
+*/
+
+namespace tf {
+
+// ----------------------------------------------------------------------------
+// Structure Definition: Pipeflow
+// ----------------------------------------------------------------------------
+
+/**
+@class Pipeflow
+
+@brief class to create a pipeflow object used by the pipe callable
+
+A pipeflow represents the scheduling state of a token at a pipe
+of a pipeline.
+It is passed to the callable of every pipe to query the line, pipe,
+and token it is running on, and to stop the pipeline at the first pipe.
+
+@code{.cpp}
+tf::Pipe{tf::PipeType::SERIAL, [](tf::Pipeflow& pf) {
+  if(pf.token() == 100) {
+    pf.stop();
+  }
+}}
+@endcode
+*/
+class Pipeflow {
+
+  template <typename... Ps>
+  friend class Pipeline;
+
+  public:
+
+  /**
+  @brief queries the line identifier of the present token
+  */
+  size_t line() const {
+    return _line;
+  }
+
+  /**
+  @brief queries the pipe identifier of the present token
+  */
+  size_t pipe() const {
+    return _pipe;
+  }
+
+  /**
+  @brief queries the token identifier
+  */
+  size_t token() const {
+    return _token;
+  }
+
+  /**
+  @brief stops the pipeline scheduling
+
+  Only the first pipe can call this method to stop the pipeline.
+  Tokens that have entered the pipeline run to the end of the pipeline.
+  Calling this method from other pipes throws an exception.
+  */
+  void stop() {
+    if(_pipe != 0) {
+      TF_THROW("can only stop pipeline at the first pipe");
+    }
+    _stop = true;
+  }
+
+  private:
+
+  size_t _line;
+  size_t _pipe;
+  size_t _token;
+  bool   _stop;
+};
+
+// ----------------------------------------------------------------------------
+// Class Definition: Pipe
+// ----------------------------------------------------------------------------
+
+/**
+@enum PipeType
+
+@brief enumeration of all pipe types
+*/
+enum class PipeType : int {
+  /** @brief parallel type */
+  PARALLEL = 1,
+  /** @brief serial type */
+  SERIAL   = 2
+};
+
+/**
+@class Pipe
+
+@brief class to create a pipe object for a pipeline stage
+
+@tparam C callable type
+
+A pipe represents a stage of a pipeline.
+A pipe can be either @em parallel or @em serial.
+A serial pipe processes tokens one at a time in their order of entering
+the pipeline, whereas a parallel pipe processes multiple tokens at the
+same time in any order.
+The callable of a pipe takes a reference to a tf::Pipeflow object.
+*/
+template <typename C = std::function<void(tf::Pipeflow&)>>
+class Pipe {
+
+  template <typename... Ps>
+  friend class Pipeline;
+
+  public:
+
+  /**
+  @brief alias of the callable type
+  */
+  using callable_t = C;
+
+  /**
+  @brief constructs the pipe object
+
+  @param d pipe type (tf::PipeType)
+  @param callable callable type
+  */
+  Pipe(PipeType d, C&& callable) :
+    _type{d}, _callable{std::forward<C>(callable)} {
+  }
+
+  /**
+  @brief queries the type of the pipe
+  */
+  PipeType type() const {
+    return _type;
+  }
+
+  private:
+
+  PipeType _type;
+
+  C _callable;
+};
+
+// ----------------------------------------------------------------------------
+// Class Definition: Pipeline
+// ----------------------------------------------------------------------------
+
+/**
+@class Pipeline
+
+@brief class to create a pipeline scheduling framework
+
+@tparam Ps pipe types
+
+A pipeline is a scheduling object for users to create a
+<i>pipeline scheduling framework</i> using a task in a taskflow
+(see tf::Taskflow::pipeline).
+Unlike the conventional pipeline programming frameworks (e.g., Intel TBB),
+%Taskflow's pipeline algorithm does not provide any data abstraction,
+which often restricts users from optimizing data layouts in their applications,
+but a flexible framework for users to customize their application data
+atop our pipeline scheduling.
+The following code creates a pipeline of four parallel lines to schedule
+tokens through three serial pipes:
+
+@code{.cpp}
+tf::Taskflow taskflow;
+tf::Executor executor;
+
+const size_t num_lines = 4;
+const size_t num_pipes = 3;
+
+// create a custom data buffer
+std::array<std::array<int, num_pipes>, num_lines> buffer;
+
+// create a pipeline graph of four concurrent lines and three serial pipes
+tf::Pipeline pipeline(num_lines,
+  // first pipe must define a serial direction
+  tf::Pipe{tf::PipeType::SERIAL, [&buffer](tf::Pipeflow& pf) {
+    // generate only 5 scheduling tokens
+    if(pf.token() == 5) {
+      pf.stop();
+    }
+    // save the token id into the buffer
+    else {
+      buffer[pf.line()][pf.pipe()] = pf.token();
+    }
+  }},
+  tf::Pipe{tf::PipeType::SERIAL, [&buffer] (tf::Pipeflow& pf) {
+    // propagate the previous result to this pipe by adding one
+    buffer[pf.line()][pf.pipe()] = buffer[pf.line()][pf.pipe()-1] + 1;
+  }},
+  tf::Pipe{tf::PipeType::SERIAL, [&buffer](tf::Pipeflow& pf){
+    // propagate the previous result to this pipe by adding one
+    buffer[pf.line()][pf.pipe()] = buffer[pf.line()][pf.pipe()-1] + 1;
+  }}
+);
+
+// add the pipeline to the taskflow
+tf::Task init = taskflow.emplace([](){ std::cout << "ready\n"; })
+                        .name("starting pipeline");
+tf::Task task = taskflow.pipeline(pipeline)
+                        .name("pipeline");
+tf::Task stop = taskflow.emplace([](){ std::cout << "stopped\n"; })
+                        .name("pipeline stopped");
+
+// create task dependency
+init.precede(task);
+task.precede(stop);
+
+// run the pipeline
+executor.run(taskflow).wait();
+@endcode
+
+The pipeline processes at most @c num_lines tokens at the same time.
+Line @c l processes the tokens @c l, <tt>l + num_lines</tt>,
+<tt>l + 2*num_lines</tt>, and so on, which gives each token a fixed
+buffer slot to pass data between pipes.
+A token on a line moves to the next pipe as soon as it finishes the present
+pipe and, if that pipe is serial, as soon as the previous token has left it.
+Every line is scheduled as a task of the executor.
+When a token finishes a pipe and enables both its own next pipe and the
+same pipe on the next line, the next line is spawned as another task while
+the present task continues with its own token.
+
+The first pipe must be serial, and only the first pipe can stop the
+pipeline using tf::Pipeflow::stop.
+Running the same pipeline again continues the token numbering from where
+the previous run stopped, unless tf::Pipeline::reset is called.
+*/
+template <typename... Ps>
+class Pipeline {
+
+  friend class FlowBuilder;
+
+  static_assert(sizeof...(Ps)>0, "must have at least one pipe");
+
+  /**
+  @private
+  */
+  struct Line {
+    std::atomic<size_t> join_counter;
+  };
+
+  /**
+  @private
+  */
+  struct PipeMeta {
+    PipeType type;
+  };
+
+  public:
+
+  /**
+  @brief constructs a pipeline object
+
+  @param num_lines the number of parallel lines
+  @param ps a list of pipes
+
+  Constructs a pipeline of up to @c num_lines parallel lines to schedule
+  tokens through the given linear chain of pipes.
+  The first pipe must define a serial direction (tf::PipeType::SERIAL)
+  or an exception will be thrown.
+  */
+  Pipeline(size_t num_lines, Ps&&... ps);
+
+  /**
+  @brief queries the number of parallel lines
+
+  The function returns the number of parallel lines given by the user
+  upon the construction of the pipeline.
+  The number of lines represents the maximum parallelism this pipeline
+  can achieve.
+  */
+  size_t num_lines() const noexcept;
+
+  /**
+  @brief queries the number of pipes
+
+  The Function returns the number of pipes given by the user
+  upon the construction of the pipeline.
+  */
+  constexpr size_t num_pipes() const noexcept;
+
+  /**
+  @brief resets the pipeline
+
+  Resetting the pipeline to the initial state. After resetting a pipeline,
+  its token identifier will start from zero as if the pipeline was just
+  constructed.
+  */
+  void reset();
+
+  /**
+  @brief queries the number of generated tokens in the pipeline
+
+  The number represents the total scheduling tokens that has been
+  generated by the pipeline so far.
+  */
+  size_t num_tokens() const noexcept;
+
+  private:
+
+  size_t _num_tokens;
+
+  std::tuple<Ps...> _pipes;
+
+  std::array<PipeMeta, sizeof...(Ps)> _meta;
+
+  std::vector<std::array<Line, sizeof...(Ps)>> _lines;
+
+  std::vector<Pipeflow> _pipeflows;
+
+  void _on_pipe(Pipeflow&);
+  void _on_line(Subflow&, Pipeflow*);
+  void _run(Subflow&);
+};
+
+// constructor
+template <typename... Ps>
+Pipeline<Ps...>::Pipeline(size_t num_lines, Ps&&... ps) :
+  _pipes     {std::forward<Ps>(ps)...},
+  _meta      {PipeMeta{ps.type()}...},
+  _lines     (num_lines),
+  _pipeflows (num_lines) {
+
+  if(num_lines == 0) {
+    TF_THROW("must have at least one line");
+  }
+
+  if(std::get<0>(_pipes).type() != PipeType::SERIAL) {
+    TF_THROW("first pipe must be serial");
+  }
+
+  reset();
+}
+
+// Function: num_lines
+template <typename... Ps>
+size_t Pipeline<Ps...>::num_lines() const noexcept {
+  return _pipeflows.size();
+}
+
+// Function: num_pipes
+template <typename... Ps>
+constexpr size_t Pipeline<Ps...>::num_pipes() const noexcept {
+  return sizeof...(Ps);
+}
+
+// Function: num_tokens
+template <typename... Ps>
+size_t Pipeline<Ps...>::num_tokens() const noexcept {
+  return _num_tokens;
+}
+
+// Procedure: reset
+template <typename... Ps>
+void Pipeline<Ps...>::reset() {
+
+  _num_tokens = 0;
+
+  for(size_t l = 0; l<num_lines(); l++) {
+    _pipeflows[l]._pipe = 0;
+    _pipeflows[l]._line = l;
+  }
+
+  // the first token enters the first line directly
+  _lines[0][0].join_counter.store(0, std::memory_order_relaxed);
+
+  // the first token has no predecessor at any pipe
+  for(size_t f=1; f<num_pipes(); f++) {
+    _lines[0][f].join_counter.store(1, std::memory_order_relaxed);
+  }
+
+  // other lines have no previous token to finish before entering the
+  // pipeline the first time
+  for(size_t l=1; l<num_lines(); l++) {
+    _lines[l][0].join_counter.store(
+      static_cast<size_t>(_meta[0].type) - 1, std::memory_order_relaxed
+    );
+    for(size_t f=1; f<num_pipes(); f++) {
+      _lines[l][f].join_counter.store(
+        static_cast<size_t>(_meta[f].type), std::memory_order_relaxed
+      );
+    }
+  }
+}
+
+// Procedure: _on_pipe
+template <typename... Ps>
+void Pipeline<Ps...>::_on_pipe(Pipeflow& pf) {
+  visit_tuple(
+    [&](auto&& pipe){ pipe._callable(pf); },
+    _pipes, pf._pipe
+  );
+}
+
+// Procedure: _on_line
+template <typename... Ps>
+void Pipeline<Ps...>::_on_line(Subflow& sf, Pipeflow* pf) {
+
+  while(1) {
+
+    // restores the dependency of the present pipe for the next token
+    _lines[pf->_line][pf->_pipe].join_counter.store(
+      static_cast<size_t>(_meta[pf->_pipe].type), std::memory_order_relaxed
+    );
+
+    if (pf->_pipe == 0) {
+      pf->_token = _num_tokens;
+      pf->_stop = false;
+      _on_pipe(*pf);
+      // tokens already in the pipeline still run to the end
+      if(pf->_stop) {
+        return;
+      }
+      ++_num_tokens;
+    }
+    else {
+      _on_pipe(*pf);
+    }
+
+    size_t c_f = pf->_pipe;
+    size_t n_f = (pf->_pipe + 1) % num_pipes();
+    size_t n_l = (pf->_line + 1) % num_lines();
+
+    pf->_pipe = n_f;
+
+    // The pipeflow must not be touched from here on, since its next pipe
+    // may be reached from either this line or the previous line.
+
+    // downward dependency: the next token may enter this serial pipe
+    bool downward = _meta[c_f].type == PipeType::SERIAL &&
+      _lines[n_l][c_f].join_counter.fetch_sub(1, std::memory_order_acq_rel) == 1;
+
+    // forward dependency: this token may enter the next pipe
+    bool forward =
+      _lines[pf->_line][n_f].join_counter.fetch_sub(1, std::memory_order_acq_rel) == 1;
+
+    if(downward && forward) {
+      sf.silent_async([this, &sf, n_l] () {
+        _on_line(sf, &_pipeflows[n_l]);
+      });
+    }
+    else if(downward) {
+      pf = &_pipeflows[n_l];
+    }
+    else if(!forward) {
+      return;
+    }
+  }
+}
+
+// Procedure: _run
+template <typename... Ps>
+void Pipeline<Ps...>::_run(Subflow& sf) {
+
+  // resumes at the line that takes the next token
+  _on_line(sf, &_pipeflows[_num_tokens % num_lines()]);
+
+  sf.join();
+}
+
+// ----------------------------------------------------------------------------
+// tf::Taskflow::pipeline
+// ----------------------------------------------------------------------------
+
+// Function: pipeline
+template <typename... Ps>
+Task FlowBuilder::pipeline(Pipeline<Ps...>& pl) {
+  return emplace([&pl] (Subflow& sf) { pl._run(sf); });
+}
+
+}  // end of namespace tf -----------------------------------------------------
+
@@ -16,7 +16,7 @@ Task FlowBuilder::reduce(B&& beg, E&& end, T& init, O bop) {
 
   Task task = emplace(
   [b=std::forward<B>(beg), e=std::forward<E>(end), &r=init, bop] 
-  (Subflow& sf) mutable {
+  (Runtime& rt) mutable {
     
     // fetch the iterator values
     I beg = b;
@@ -28,7 +28,7 @@ Task FlowBuilder::reduce(B&& beg, E&& end, T& init, O bop) {
 
     //size_t C = (c == 0) ? 1 : c;
     size_t C = 1;
-    size_t W = sf._executor.num_workers();
+    size_t W = rt.executor().num_workers();
     size_t N = std::distance(beg, end);
     
     // only myself - no need to spawn another graph
@@ -44,85 +44,76 @@ Task FlowBuilder::reduce(B&& beg, E&& end, T& init, O bop) {
     std::mutex mutex;
     std::atomic<size_t> next(0);
 
-    for(size_t w=0; w<W; w++) {
+    auto loop = [&mutex, &next, &r, beg, N, W, bop, C] () mutable {
+      
+      size_t s0 = next.fetch_add(2, std::memory_order_relaxed);
 
-      if(w*2 >= N) {
-        break;
+      if(s0 >= N) {
+        return;
       }
-
-      //sf.emplace([&mutex, &next, &r, beg, N, W, o, C] () mutable {
-      sf.silent_async([&mutex, &next, &r, beg, N, W, bop, C] () mutable {
         
-        size_t s0 = next.fetch_add(2, std::memory_order_relaxed);
-
-        if(s0 >= N) {
-          return;
-        }
-          
-        std::advance(beg, s0);
+      std::advance(beg, s0);
 
-        if(N - s0 == 1) {
-          std::lock_guard<std::mutex> lock(mutex);
-          r = bop(r, *beg);
-          return;
-        }
+      if(N - s0 == 1) {
+        std::lock_guard<std::mutex> lock(mutex);
+        r = bop(r, *beg);
+        return;
+      }
 
-        auto beg1 = beg++;
-        auto beg2 = beg++;
+      auto beg1 = beg++;
+      auto beg2 = beg++;
+      
+      T sum = bop(*beg1, *beg2);
+            
+      size_t z = s0 + 2;
+      size_t p1 = 2 * W * (C + 1);
+      double p2 = 0.5 / static_cast<double>(W);
+      s0 = next.load(std::memory_order_relaxed);
+
+      while(s0 < N) {
         
-        T sum = bop(*beg1, *beg2);
-              
-        size_t z = s0 + 2;
-        size_t p1 = 2 * W * (C + 1);
-        double p2 = 0.5 / static_cast<double>(W);
-        s0 = next.load(std::memory_order_relaxed);
-
-        while(s0 < N) {
-          
-          size_t r = N - s0;
-          
-          // fine-grained
-          if(r < p1) {
-            while(1) {
-              s0 = next.fetch_add(C, std::memory_order_relaxed);
-              if(s0 >= N) {
-                break;
-              }
-              size_t e0 = (C <= (N - s0)) ? s0 + C : N;
-              std::advance(beg, s0-z);
-              for(size_t x=s0; x<e0; x++, beg++) {
-                sum = bop(sum, *beg); 
-              }
-              z = e0;
+        size_t r = N - s0;
+        
+        // fine-grained
+        if(r < p1) {
+          while(1) {
+            s0 = next.fetch_add(C, std::memory_order_relaxed);
+            if(s0 >= N) {
+              break;
             }
-            break;
-          }
-          // coarse-grained
-          else {
-            size_t q = static_cast<size_t>(p2 * r);
-            if(q < C) {
-              q = C;
+            size_t e0 = (C <= (N - s0)) ? s0 + C : N;
+            std::advance(beg, s0-z);
+            for(size_t x=s0; x<e0; x++, beg++) {
+              sum = bop(sum, *beg); 
             }
-            size_t e0 = (q <= r) ? s0 + q : N;
-            if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
-                                                    std::memory_order_relaxed)) {
-              std::advance(beg, s0-z);
-              for(size_t x = s0; x<e0; x++, beg++) {
-                sum = bop(sum, *beg); 
-              }
-              z = e0;
-              s0 = next.load(std::memory_order_relaxed);
+            z = e0;
+          }
+          break;
+        }
+        // coarse-grained
+        else {
+          size_t q = static_cast<size_t>(p2 * r);
+          if(q < C) {
+            q = C;
+          }
+          size_t e0 = (q <= r) ? s0 + q : N;
+          if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
+                                                  std::memory_order_relaxed)) {
+            std::advance(beg, s0-z);
+            for(size_t x = s0; x<e0; x++, beg++) {
+              sum = bop(sum, *beg); 
             }
+            z = e0;
+            s0 = next.load(std::memory_order_relaxed);
           }
         }
+      }
 
-        std::lock_guard<std::mutex> lock(mutex);
-        r = bop(r, sum);
-      //}).name("prg_"s + std::to_string(w));
-      });
-    }
-    
-    sf.join();
+      std::lock_guard<std::mutex> lock(mutex);
+      r = bop(r, sum);
+    };
+
+    corun_loop(rt, std::min(W, (N + 1) / 2), loop);
   });  
 
   return task;
@@ -142,7 +133,7 @@ Task FlowBuilder::transform_reduce(
 
   Task task = emplace(
   [b=std::forward<B>(beg), e=std::forward<E>(end), &r=init, bop, uop] 
-  (Subflow& sf) mutable {
+  (Runtime& rt) mutable {
     
     // fetch the iterator values
     I beg = b;
@@ -154,7 +145,7 @@ Task FlowBuilder::transform_reduce(
 
     //size_t C = (c == 0) ? 1 : c;
     size_t C = 1;
-    size_t W = sf._executor.num_workers();
+    size_t W = rt.executor().num_workers();
     size_t N = std::distance(beg, end);
     
     // only myself - no need to spawn another graph
@@ -170,82 +161,296 @@ Task FlowBuilder::transform_reduce(
     std::mutex mutex;
     std::atomic<size_t> next(0);
 
-    for(size_t w=0; w<W; w++) {
+    auto loop = [&mutex, &next, &r, beg, N, W, bop, uop, C] () mutable {
+      
+      size_t s0 = next.fetch_add(2, std::memory_order_relaxed);
+
+      if(s0 >= N) {
+        return;
+      }
+        
+      std::advance(beg, s0);
 
-      if(w*2 >= N) {
-        break;
+      if(N - s0 == 1) {
+        std::lock_guard<std::mutex> lock(mutex);
+        r = bop(r, uop(*beg));
+        return;
       }
 
-      //sf.emplace([&mutex, &next, &r, beg, N, W, bop, uop, C] () mutable {
-      sf.silent_async([&mutex, &next, &r, beg, N, W, bop, uop, C] () mutable {
+      auto beg1 = beg++;
+      auto beg2 = beg++;
+      
+      T sum = bop(uop(*beg1), uop(*beg2));
+            
+      size_t z = s0 + 2;
+      size_t p1 = 2 * W * (C + 1);
+      double p2 = 0.5 / static_cast<double>(W);
+      s0 = next.load(std::memory_order_relaxed);
+
+      while(s0 < N) {
+        
+        size_t r = N - s0;
         
-        size_t s0 = next.fetch_add(2, std::memory_order_relaxed);
+        // fine-grained
+        if(r < p1) {
+          while(1) {
+            s0 = next.fetch_add(C, std::memory_order_relaxed);
+            if(s0 >= N) {
+              break;
+            }
+            size_t e0 = (C <= (N - s0)) ? s0 + C : N;
+            std::advance(beg, s0-z);
+            for(size_t x=s0; x<e0; x++, beg++) {
+              sum = bop(sum, uop(*beg)); 
+            }
+            z = e0;
+          }
+          break;
+        }
+        // coarse-grained
+        else {
+          size_t q = static_cast<size_t>(p2 * r);
+          if(q < C) {
+            q = C;
+          }
+          size_t e0 = (q <= r) ? s0 + q : N;
+          if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
+                                                  std::memory_order_relaxed)) {
+            std::advance(beg, s0-z);
+            for(size_t x = s0; x<e0; x++, beg++) {
+              sum = bop(sum, uop(*beg)); 
+            }
+            z = e0;
+            s0 = next.load(std::memory_order_relaxed);
+          }
+        }
+      }
 
-        if(s0 >= N) {
-          return;
+      std::lock_guard<std::mutex> lock(mutex);
+      r = bop(r, sum);
+    };
+
+    corun_loop(rt, std::min(W, (N + 1) / 2), loop);
+  });  
+
+  return task;
+}
+
+// ----------------------------------------------------------------------------
+// histogram
+// ----------------------------------------------------------------------------
+
+// Function: histogram
+template <typename B, typename E, typename H, typename F>
+Task FlowBuilder::histogram(B&& beg, E&& end, H& bins, F binning_fn) {
+  
+  using I = stateful_iterator_t<B, E>;
+  using T = std::decay_t<decltype(bins[0])>;
+
+  Task task = emplace(
+  [b=std::forward<B>(beg), e=std::forward<E>(end), &h=bins, binning_fn] 
+  (Subflow& sf) mutable {
+    
+    // fetch the iterator values
+    I beg = b;
+    I end = e;
+  
+    if(beg == end) {
+      return;
+    }
+
+    size_t K = std::size(h);
+    size_t N = std::distance(beg, end);
+
+    // every worker handles at least as many elements as it has bins to merge
+    size_t W = std::min(
+      sf._executor.num_workers(), N / std::max(K, size_t{1024})
+    );
+    
+    // only myself - no need to spawn another graph
+    if(W <= 1) {
+      for(; beg!=end; beg++) {
+        if(size_t k = binning_fn(*beg); k < K) {
+          ++h[k];
         }
-          
+      }
+      return;
+    }
+
+    // each worker counts a contiguous block of the range into private bins
+    std::vector<std::vector<T>> locals(W);
+    std::atomic<size_t> pending(W);
+
+    for(size_t w=0; w<W; w++) {
+
+      sf.silent_async(
+      [&sf, &h, &locals, &pending, beg, N, W, K, w, binning_fn] () mutable {
+        
+        auto& local = locals[w];
+        local.resize(K, T{});
+
+        size_t s0 = w * N / W;
+        size_t e0 = (w + 1) * N / W;
+
         std::advance(beg, s0);
 
-        if(N - s0 == 1) {
-          std::lock_guard<std::mutex> lock(mutex);
-          r = bop(r, uop(*beg));
+        for(size_t x=s0; x<e0; x++, beg++) {
+          if(size_t k = binning_fn(*beg); k < K) {
+            ++local[k];
+          }
+        }
+
+        if(pending.fetch_sub(1, std::memory_order_acq_rel) != 1) {
           return;
         }
 
-        auto beg1 = beg++;
-        auto beg2 = beg++;
-        
-        T sum = bop(uop(*beg1), uop(*beg2));
-              
-        size_t z = s0 + 2;
-        size_t p1 = 2 * W * (C + 1);
-        double p2 = 0.5 / static_cast<double>(W);
-        s0 = next.load(std::memory_order_relaxed);
-
-        while(s0 < N) {
-          
-          size_t r = N - s0;
-          
-          // fine-grained
-          if(r < p1) {
-            while(1) {
-              s0 = next.fetch_add(C, std::memory_order_relaxed);
-              if(s0 >= N) {
-                break;
-              }
-              size_t e0 = (C <= (N - s0)) ? s0 + C : N;
-              std::advance(beg, s0-z);
-              for(size_t x=s0; x<e0; x++, beg++) {
-                sum = bop(sum, uop(*beg)); 
+        // the last worker merges the private bins in parallel
+        size_t S = std::min(W, (K + 1023) / 1024);
+
+        for(size_t s=0; s<S; s++) {
+          sf.silent_async([&h, &locals, W, K, S, s] () {
+            for(size_t k=s*K/S; k<(s+1)*K/S; k++) {
+              for(size_t v=0; v<W; v++) {
+                h[k] += locals[v][k];
               }
-              z = e0;
             }
-            break;
-          }
-          // coarse-grained
-          else {
-            size_t q = static_cast<size_t>(p2 * r);
-            if(q < C) {
-              q = C;
+          });
+        }
+      });
+    }
+    
+    sf.join();
+  });  
+
+  return task;
+}
+
+// ----------------------------------------------------------------------------
+// reduce by key
+// ----------------------------------------------------------------------------
+
+// Function: reduce_by_key
+template <
+  typename B, typename E, typename V, typename KO, typename VO, 
+  typename O, typename R
+>
+Task FlowBuilder::reduce_by_key(
+  B&& keys_beg, E&& keys_end, V&& vals_beg, KO&& keys_out, VO&& vals_out,
+  O bop, R& result
+) {
+  
+  using KI = stateful_iterator_t<B, E>;
+  using VI = stateful_iterator_t<V, V>;
+  using KD = stateful_iterator_t<KO, KO>;
+  using VD = stateful_iterator_t<VO, VO>;
+  using T  = typename std::iterator_traits<VD>::value_type;
+
+  Task task = emplace(
+  [b=std::forward<B>(keys_beg), e=std::forward<E>(keys_end), 
+   v=std::forward<V>(vals_beg), ko=std::forward<KO>(keys_out), 
+   vo=std::forward<VO>(vals_out), bop, &r=result] (Subflow& sf) mutable {
+    
+    // fetch the iterator values
+    KI kbeg = b;
+    KI kend = e;
+    VI vbeg = v;
+    KD kout = ko;
+    VD vout = vo;
+  
+    size_t N = std::distance(kbeg, kend);
+
+    // reduces the runs starting in [s0, e0) and returns the reduction of
+    // the run prefix that continues from before s0, if any
+    auto reduce_runs = [=] (size_t s0, size_t e0, size_t o) mutable {
+
+      std::optional<T> carry;
+      size_t i = s0;
+
+      if(i != 0 && kbeg[i-1] == kbeg[i]) {
+        T sum = vbeg[i++];
+        for(; i<e0 && kbeg[i-1] == kbeg[i]; i++) {
+          sum = bop(sum, vbeg[i]);
+        }
+        carry = std::move(sum);
+      }
+
+      while(i < e0) {
+        kout[o] = kbeg[i];
+        T sum = vbeg[i++];
+        for(; i<e0 && kbeg[i-1] == kbeg[i]; i++) {
+          sum = bop(sum, vbeg[i]);
+        }
+        vout[o++] = std::move(sum);
+      }
+
+      return carry;
+    };
+
+    size_t W = std::min(sf._executor.num_workers(), N / 1024);
+    
+    // only myself - no need to spawn another graph
+    if(W <= 1) {
+      size_t M = 0;
+      for(size_t i=0; i<N; i++) {
+        M += (i == 0 || !(kbeg[i-1] == kbeg[i]));
+      }
+      reduce_runs(0, N, 0);
+      r = {kout + M, vout + M};
+      return;
+    }
+
+    // each worker first counts the runs that start in its block to find 
+    // the output offset of the block, then reduces these runs up to the 
+    // end of the block; the partial runs that cross block boundaries are 
+    // combined at last
+    std::vector<size_t> offsets(W+1, 0);
+    std::vector<std::optional<T>> carries(W);
+    std::atomic<size_t> pending(W);
+
+    for(size_t w=0; w<W; w++) {
+
+      sf.silent_async(
+      [&sf, &r, &offsets, &carries, &pending, kbeg, kout, vout, N, W, w, 
+       bop, reduce_runs] () mutable {
+        
+        size_t s0 = w * N / W;
+        size_t e0 = (w + 1) * N / W;
+        size_t n = 0;
+
+        for(size_t i=s0; i<e0; i++) {
+          n += (i == 0 || !(kbeg[i-1] == kbeg[i]));
+        }
+
+        offsets[w+1] = n;
+
+        if(pending.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+          return;
+        }
+
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        r = {kout + offsets[W], vout + offsets[W]};
+        pending.store(W, std::memory_order_relaxed);
+
+        for(size_t u=0; u<W; u++) {
+          sf.silent_async(
+          [&offsets, &carries, &pending, vout, N, W, u, bop, reduce_runs] 
+          () mutable {
+
+            carries[u] = reduce_runs(u * N / W, (u + 1) * N / W, offsets[u]);
+
+            if(pending.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+              return;
             }
-            size_t e0 = (q <= r) ? s0 + q : N;
-            if(next.compare_exchange_strong(s0, e0, std::memory_order_relaxed,
-                                                    std::memory_order_relaxed)) {
-              std::advance(beg, s0-z);
-              for(size_t x = s0; x<e0; x++, beg++) {
-                sum = bop(sum, uop(*beg)); 
+
+            // block 0 always starts a run, so the carry of block x belongs 
+            // to the last run started before it
+            for(size_t x=1; x<W; x++) {
+              if(carries[x]) {
+                vout[offsets[x]-1] = bop(vout[offsets[x]-1], *carries[x]);
               }
-              z = e0;
-              s0 = next.load(std::memory_order_relaxed);
             }
-          }
+          });
         }
-
-        std::lock_guard<std::mutex> lock(mutex);
-        r = bop(r, sum);
-
-      //}).name("prg_"s + std::to_string(w));
       });
     }
     
@@ -255,6 +460,45 @@ Task FlowBuilder::transform_reduce(
   return task;
 }
 
+// ----------------------------------------------------------------------------
+// executor-level parallel reduce
+// ----------------------------------------------------------------------------
+
+// Function: parallel_reduce
+template <typename B, typename E, typename T, typename O>
+T Executor::parallel_reduce(B first, E last, T init, O bop, size_t chunk_size) {
+
+  using I = std::common_type_t<B, E>;
+
+  std::mutex mutex;
+  
+  // every thread reduces its chunks into a partial sum of its own and 
+  // merges the partial sum into the result once
+  auto f = [&mutex, &init, bop] (auto&& claim) mutable {
+    
+    I b, e;
+    std::optional<T> sum;
+
+    while(claim(b, e)) {
+      if(!sum && b != e) {
+        sum.emplace(*b++);
+      }
+      for(; b!=e; ++b) {
+        *sum = bop(std::move(*sum), *b);
+      }
+    }
+
+    if(sum) {
+      std::lock_guard<std::mutex> lock(mutex);
+      init = bop(std::move(init), std::move(*sum));
+    }
+  };
+
+  _parallel_for_chunks(I(first), I(last), chunk_size, f);
+
+  return init;
+}
+
 }  // end of namespace tf -----------------------------------------------------
 
 
@@ -27,6 +27,12 @@ constexpr size_t parallel_sort_cutoff() {
   }
 }
 
+// threshold whether or not to partition a range in parallel
+template <typename I>
+constexpr size_t parallel_partition_cutoff() {
+  return parallel_sort_cutoff<I>() << 6;
+}
+
 // ----------------------------------------------------------------------------
 // pattern-defeating quick sort (pdqsort)
 // ----------------------------------------------------------------------------
@@ -218,19 +224,258 @@ RandItr partition_left(RandItr begin, RandItr end, Compare comp) {
   return pivot_pos;
 }
 
+// Shuffles elements on both sides of a highly unbalanced partition
+// to break the pattern that produced the bad pivot.
+template<typename Iter>
+void break_patterns(Iter begin, Iter pivot_pos, Iter end) {
+
+  // Partitions below this size are sorted using insertion sort
+  constexpr size_t insertion_sort_threshold = 24;
+
+  // Partitions above this size use Tukey's ninther to select the pivot.
+  constexpr size_t ninther_threshold = 128;
+
+  size_t l_size = pivot_pos - begin;
+  size_t r_size = end - (pivot_pos + 1);
+
+  if (l_size >= insertion_sort_threshold) {
+    std::iter_swap(begin, begin + l_size / 4);
+    std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+    if (l_size > ninther_threshold) {
+      std::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+      std::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+      std::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+      std::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+    }
+  }
+
+  if (r_size >= insertion_sort_threshold) {
+    std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+    std::iter_swap(end - 1,                   end - r_size / 4);
+    if (r_size > ninther_threshold) {
+      std::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+      std::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+      std::iter_swap(end - 2,             end - (1 + r_size / 4));
+      std::iter_swap(end - 3,             end - (2 + r_size / 4));
+    }
+  }
+}
+
 template<typename Iter, typename Compare>
 void parallel_pdqsort(
-  tf::Subflow& sf,
+  tf::Subflow& sf, size_t W,
   Iter begin, Iter end, Compare comp, 
   int bad_allowed, bool leftmost = true
+);
+
+// ----------------------------------------------------------------------------
+// parallel partition
+// ----------------------------------------------------------------------------
+
+// Shared state of partitioning [begin+1, end) around the pivot *begin.
+// The range is split into one contiguous block per worker; each block is
+// partitioned locally, and the elements that end up on the wrong side of
+// the global split point are then swapped back in parallel.
+template<typename Iter, typename Compare>
+struct ParallelPartition {
+
+  // [beg, end) offsets relative to begin+1
+  using interval_t = std::pair<size_t, size_t>;
+
+  ParallelPartition(Iter b, Iter e, Compare c, int ba, bool lm) :
+    begin {b}, end {e}, comp {c}, bad_allowed {ba}, leftmost {lm} {
+  }
+
+  Iter begin;
+  Iter end;
+  Compare comp;
+  int bad_allowed;
+  bool leftmost;
+
+  std::vector<size_t> bounds;     // block boundaries
+  std::vector<size_t> num_less;   // number of elements < pivot per block
+  
+  std::vector<interval_t> lmis;   // elements >= pivot left of the split 
+  std::vector<interval_t> rmis;   // elements <  pivot right of the split
+  
+  size_t split {0};
+  size_t num_misplaced {0};
+
+  std::atomic<size_t> pending {0};
+};
+
+// Places the pivot and recurses into both sides of a parallel partition.
+template<typename Iter, typename Compare>
+void parallel_partition_finish(
+  tf::Subflow& sf, size_t W, 
+  std::shared_ptr<ParallelPartition<Iter, Compare>> pp
+) {
+
+  Iter begin = pp->begin;
+  Iter end = pp->end;
+  int bad_allowed = pp->bad_allowed;
+  bool leftmost = pp->leftmost;
+
+  Iter pivot_pos = begin + pp->split;
+  std::iter_swap(begin, pivot_pos);
+
+  size_t size = end - begin;
+  size_t l_size = pivot_pos - begin;
+  size_t r_size = end - (pivot_pos + 1);
+  
+  if (l_size < size / 8 || r_size < size / 8) {
+    if (--bad_allowed == 0) {
+      std::make_heap(begin, end, pp->comp);
+      std::sort_heap(begin, end, pp->comp);
+      return;
+    }
+    break_patterns(begin, pivot_pos, end);
+  }
+
+  sf.silent_async(
+    [&sf, W, begin, pivot_pos, comp=pp->comp, bad_allowed, leftmost] () mutable {
+      parallel_pdqsort(sf, W, begin, pivot_pos, comp, bad_allowed, leftmost);
+    }
+  );
+  
+  parallel_pdqsort(sf, W, pivot_pos + 1, end, pp->comp, bad_allowed, false);
+}
+
+// Swaps the misplaced elements of a block-partitioned range in parallel.
+template<typename Iter, typename Compare>
+void parallel_partition_swap(
+  tf::Subflow& sf, size_t W, 
+  std::shared_ptr<ParallelPartition<Iter, Compare>> pp
 ) {
   
-  // Partitions below this size are sorted sequentially
   constexpr auto cutoff = parallel_sort_cutoff<Iter>();
   
-  // Partitions below this size are sorted using insertion sort
-  constexpr auto insertion_sort_threshold = 24;
+  const size_t B = pp->num_less.size();
+
+  pp->split = std::accumulate(pp->num_less.begin(), pp->num_less.end(), size_t{0});
+
+  // collect the misplaced intervals on each side of the split point
+  for(size_t b=0; b<B; b++) {
+    size_t lb = pp->bounds[b];
+    size_t mb = lb + pp->num_less[b];
+    size_t rb = pp->bounds[b+1];
+    if(mb < pp->split && mb < rb) {
+      pp->lmis.emplace_back(mb, std::min(rb, pp->split));
+      pp->num_misplaced += pp->lmis.back().second - mb;
+    }
+    if(mb > pp->split && lb < mb) {
+      pp->rmis.emplace_back(std::max(lb, pp->split), mb);
+    }
+  }
+
+  const size_t M = pp->num_misplaced;
+
+  if(M == 0) {
+    parallel_partition_finish(sf, W, std::move(pp));
+    return;
+  }
 
+  const size_t S = std::min(B, (M + cutoff - 1) / cutoff);
+
+  pp->pending.store(S, std::memory_order_relaxed);
+
+  for(size_t s=0; s<S; s++) {
+    sf.silent_async([&sf, W, pp, s, S, M] () mutable {
+      
+      size_t beg = s * M / S;
+      size_t cnt = (s + 1) * M / S - beg;
+      
+      // locates the beg-th element in the given interval list
+      auto locate = [beg] (const auto& intervals) {
+        size_t i = 0, off = beg;
+        while(off >= intervals[i].second - intervals[i].first) {
+          off -= intervals[i].second - intervals[i].first;
+          ++i;
+        }
+        return std::make_pair(i, intervals[i].first + off);
+      };
+
+      auto [li, lp] = locate(pp->lmis);
+      auto [ri, rp] = locate(pp->rmis);
+      auto first = pp->begin + 1;
+
+      while(cnt--) {
+        std::iter_swap(first + lp, first + rp);
+        if(++lp == pp->lmis[li].second && cnt) {
+          lp = pp->lmis[++li].first;
+        }
+        if(++rp == pp->rmis[ri].second && cnt) {
+          rp = pp->rmis[++ri].first;
+        }
+      }
+
+      if(pp->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        parallel_partition_finish(sf, W, std::move(pp));
+      }
+    });
+  }
+}
+
+// Partitions [begin+1, end) around the pivot *begin using up to W workers 
+// and then continues pdqsort on both sides. 
+// Elements equal to the pivot are put in the right-hand partition.
+template<typename Iter, typename Compare>
+void parallel_partition(
+  tf::Subflow& sf, size_t W,
+  Iter begin, Iter end, Compare comp, 
+  int bad_allowed, bool leftmost
+) {
+  
+  constexpr auto cutoff = parallel_sort_cutoff<Iter>();
+  
+  const size_t N = end - begin - 1;
+  const size_t B = std::min(W, N / cutoff);
+
+  auto pp = std::make_shared<ParallelPartition<Iter, Compare>>(
+    begin, end, comp, bad_allowed, leftmost
+  );
+  
+  pp->bounds.resize(B + 1);
+  pp->num_less.resize(B);
+  for(size_t b=0; b<=B; b++) {
+    pp->bounds[b] = b * N / B;
+  }
+  pp->pending.store(B, std::memory_order_relaxed);
+
+  for(size_t b=0; b<B; b++) {
+    sf.silent_async([&sf, W, pp, b, comp] () mutable {
+      auto first = pp->begin + 1;
+      decltype(auto) pivot = *(pp->begin);
+      auto mid = std::partition(
+        first + pp->bounds[b], first + pp->bounds[b+1], 
+        [&] (const auto& item) { return comp(item, pivot); }
+      );
+      pp->num_less[b] = (mid - first) - pp->bounds[b];
+      
+      if(pp->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        parallel_partition_swap(sf, W, std::move(pp));
+      }
+    });
+  }
+}
+
+// ----------------------------------------------------------------------------
+// parallel pdqsort
+// ----------------------------------------------------------------------------
+
+template<typename Iter, typename Compare>
+void parallel_pdqsort(
+  tf::Subflow& sf, size_t W,
+  Iter begin, Iter end, Compare comp, 
+  int bad_allowed, bool leftmost
+) {
+  
+  // Partitions below this size are sorted sequentially
+  constexpr auto cutoff = parallel_sort_cutoff<Iter>();
+  
+  // Partitions above this size are partitioned in parallel
+  constexpr auto parallel_cutoff = parallel_partition_cutoff<Iter>();
+  
   // Partitions above this size use Tukey's ninther to select the pivot.
   constexpr auto ninther_threshold = 128;
 
@@ -284,6 +529,13 @@ void parallel_pdqsort(
       continue;
     }
 
+    // Large partitions are split by multiple workers, which take over
+    // sorting both sides once they are done.
+    if (W > 1 && size >= parallel_cutoff) {
+      parallel_partition(sf, W, begin, end, comp, bad_allowed, leftmost);
+      return;
+    }
+
     // Partition and get results.
     auto pair = partition_right(begin, end, comp);
     auto pivot_pos = pair.first;
@@ -307,27 +559,7 @@ void parallel_pdqsort(
         return;
       }
 
-      if (l_size >= insertion_sort_threshold) {
-        std::iter_swap(begin, begin + l_size / 4);
-        std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
-        if (l_size > ninther_threshold) {
-          std::iter_swap(begin + 1, begin + (l_size / 4 + 1));
-          std::iter_swap(begin + 2, begin + (l_size / 4 + 2));
-          std::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
-          std::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
-        }
-      }
-
-      if (r_size >= insertion_sort_threshold) {
-        std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
-        std::iter_swap(end - 1,                   end - r_size / 4);
-        if (r_size > ninther_threshold) {
-          std::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
-          std::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
-          std::iter_swap(end - 2,             end - (1 + r_size / 4));
-          std::iter_swap(end - 3,             end - (2 + r_size / 4));
-        }
-      }
+      break_patterns(begin, pivot_pos, end);
     } 
     // decently balanced
     else {
@@ -343,8 +575,8 @@ void parallel_pdqsort(
     // Sort the left partition first using recursion and 
     // do tail recursion elimination for the right-hand partition.
     sf.silent_async(
-      [&sf, begin, pivot_pos, comp, bad_allowed, leftmost] () mutable {
-        parallel_pdqsort(sf, begin, pivot_pos, comp, bad_allowed, leftmost);
+      [&sf, W, begin, pivot_pos, comp, bad_allowed, leftmost] () mutable {
+        parallel_pdqsort(sf, W, begin, pivot_pos, comp, bad_allowed, leftmost);
       }
     );
     begin = pivot_pos + 1;
@@ -423,6 +655,173 @@ void parallel_3wqsort(tf::Subflow& sf, RandItr first, RandItr last, C compare) {
   //sf.join();
 }
 
+// ----------------------------------------------------------------------------
+// key-value iterator
+// ----------------------------------------------------------------------------
+
+template <typename KI, typename VI>
+class KeyValueRef;
+
+// Class: KeyValue
+// An owning key-value pair that holds an element of a key-value iterator
+// while it is moved around by a sorting algorithm.
+template <typename K, typename V>
+struct KeyValue {
+
+  K key;
+  V value;
+
+  KeyValue(const KeyValue&) = default;
+  KeyValue(KeyValue&&) = default;
+  
+  KeyValue& operator = (const KeyValue&) = default;
+  KeyValue& operator = (KeyValue&&) = default;
+
+  template <typename KI, typename VI>
+  KeyValue(const KeyValueRef<KI, VI>& ref) : 
+    key {ref.key}, value {ref.value} {
+  }
+
+  template <typename KI, typename VI>
+  KeyValue(KeyValueRef<KI, VI>&& ref) : 
+    key {std::move(ref.key)}, value {std::move(ref.value)} {
+  }
+};
+
+// Class: KeyValueRef
+// A proxy reference to the key and the value at the same position of 
+// two separate ranges. Assignment and swap act on the referenced elements.
+template <typename KI, typename VI>
+class KeyValueRef {
+
+  public:
+
+  using key_type    = typename std::iterator_traits<KI>::value_type;
+  using mapped_type = typename std::iterator_traits<VI>::value_type;
+  using value_type  = KeyValue<key_type, mapped_type>;
+  
+  typename std::iterator_traits<KI>::reference key;
+  typename std::iterator_traits<VI>::reference value;
+
+  KeyValueRef(
+    typename std::iterator_traits<KI>::reference k,
+    typename std::iterator_traits<VI>::reference v
+  ) : key {k}, value {v} {
+  }
+
+  KeyValueRef(const KeyValueRef&) = default;
+
+  KeyValueRef& operator = (const KeyValueRef& rhs) {
+    key = rhs.key;
+    value = rhs.value;
+    return *this;
+  }
+  
+  KeyValueRef& operator = (KeyValueRef&& rhs) {
+    key = std::move(rhs.key);
+    value = std::move(rhs.value);
+    return *this;
+  }
+
+  KeyValueRef& operator = (const value_type& rhs) {
+    key = rhs.key;
+    value = rhs.value;
+    return *this;
+  }
+  
+  KeyValueRef& operator = (value_type&& rhs) {
+    key = std::move(rhs.key);
+    value = std::move(rhs.value);
+    return *this;
+  }
+
+  friend void swap(KeyValueRef lhs, KeyValueRef rhs) {
+    using std::swap;
+    swap(lhs.key, rhs.key);
+    swap(lhs.value, rhs.value);
+  }
+};
+
+// Class: KeyValueIterator
+// A random-access iterator that walks a key range and a value range in 
+// lockstep, so that sorting algorithms can permute both without 
+// materializing an array of key-value pairs.
+template <typename KI, typename VI>
+class KeyValueIterator {
+
+  public:
+
+  using reference         = KeyValueRef<KI, VI>;
+  using value_type        = typename reference::value_type;
+  using difference_type   = typename std::iterator_traits<KI>::difference_type;
+  using pointer           = void;
+  using iterator_category = std::random_access_iterator_tag;
+
+  KeyValueIterator() = default;
+
+  KeyValueIterator(KI k, VI v) : _k {k}, _v {v} {
+  }
+
+  reference operator * () const { return reference(*_k, *_v); }
+  reference operator [] (difference_type n) const { return reference(_k[n], _v[n]); }
+
+  KeyValueIterator& operator ++ () { ++_k; ++_v; return *this; }
+  KeyValueIterator& operator -- () { --_k; --_v; return *this; }
+  KeyValueIterator  operator ++ (int) { auto t = *this; ++(*this); return t; }
+  KeyValueIterator  operator -- (int) { auto t = *this; --(*this); return t; }
+
+  KeyValueIterator& operator += (difference_type n) { _k += n; _v += n; return *this; }
+  KeyValueIterator& operator -= (difference_type n) { _k -= n; _v -= n; return *this; }
+
+  KeyValueIterator operator + (difference_type n) const { return {_k + n, _v + n}; }
+  KeyValueIterator operator - (difference_type n) const { return {_k - n, _v - n}; }
+  
+  friend KeyValueIterator operator + (difference_type n, const KeyValueIterator& i) {
+    return i + n;
+  }
+
+  difference_type operator - (const KeyValueIterator& rhs) const { return _k - rhs._k; }
+
+  bool operator == (const KeyValueIterator& rhs) const { return _k == rhs._k; }
+  bool operator != (const KeyValueIterator& rhs) const { return _k != rhs._k; }
+  bool operator <  (const KeyValueIterator& rhs) const { return _k <  rhs._k; }
+  bool operator >  (const KeyValueIterator& rhs) const { return _k >  rhs._k; }
+  bool operator <= (const KeyValueIterator& rhs) const { return _k <= rhs._k; }
+  bool operator >= (const KeyValueIterator& rhs) const { return _k >= rhs._k; }
+
+  private:
+
+  KI _k;
+  VI _v;
+};
+
+// ----------------------------------------------------------------------------
+// parallel sort
+// ----------------------------------------------------------------------------
+
+// Procedure: parallel_sort
+// sorts [beg, end) using the W workers available to the given subflow
+template <typename I, typename C>
+void parallel_sort(tf::Subflow& sf, size_t W, I beg, I end, C cmp) {
+  
+  if(beg == end) {
+    return;
+  }
+
+  size_t N = std::distance(beg, end);
+
+  // only myself - no need to spawn another graph
+  if(W <= 1 || N <= parallel_sort_cutoff<I>()) {
+    std::sort(beg, end, cmp);
+    return;
+  }
+
+  //parallel_3wqsort(sf, beg, end-1, c);
+  parallel_pdqsort(sf, W, beg, end, cmp, log2(end - beg));
+
+  sf.join();
+}
+
 // ----------------------------------------------------------------------------
 // tf::Taskflow::sort
 // ----------------------------------------------------------------------------
@@ -440,23 +839,7 @@ Task FlowBuilder::sort(B&& beg, E&& end, C cmp) {
     I beg = b;
     I end = e;
   
-    if(beg == end) {
-      return;
-    }
-
-    size_t W = sf._executor.num_workers();
-    size_t N = std::distance(beg, end);
-
-    // only myself - no need to spawn another graph
-    if(W <= 1 || N <= parallel_sort_cutoff<I>()) {
-      std::sort(beg, end, cmp);
-      return;
-    }
-
-    //parallel_3wqsort(sf, beg, end-1, c);
-    parallel_pdqsort(sf, beg, end, cmp, log2(end - beg));
-
-    sf.join();
+    parallel_sort(sf, sf._executor.num_workers(), beg, end, cmp);
   });  
 
   return task;
@@ -475,5 +858,101 @@ Task FlowBuilder::sort(B&& beg, E&& end) {
   );
 }
 
+// ----------------------------------------------------------------------------
+// tf::Taskflow::sort_by_key
+// ----------------------------------------------------------------------------
+
+// Function: sort_by_key
+template <typename B, typename E, typename V, typename C>
+Task FlowBuilder::sort_by_key(B&& keys_beg, E&& keys_end, V&& vals_beg, C cmp) {
+  
+  using K = stateful_iterator_t<B, E>;
+  using I = stateful_iterator_t<V, V>;
+
+  Task task = emplace(
+  [b=std::forward<B>(keys_beg), e=std::forward<E>(keys_end), 
+   v=std::forward<V>(vals_beg), cmp] (Subflow& sf) mutable {
+    
+    // fetch the iterator values
+    K beg = b;
+    K end = e;
+    I val = v;
+
+    KeyValueIterator<K, I> kv_beg(beg, val);
+    KeyValueIterator<K, I> kv_end(end, val + std::distance(beg, end));
+  
+    parallel_sort(
+      sf, sf._executor.num_workers(), kv_beg, kv_end, 
+      [cmp] (const auto& l, const auto& r) mutable { 
+        return cmp(l.key, r.key); 
+      }
+    );
+  });  
+
+  return task;
+}
+
+// Function: sort_by_key
+template <typename B, typename E, typename V>
+Task FlowBuilder::sort_by_key(B&& keys_beg, E&& keys_end, V&& vals_beg) {
+  
+  using K = stateful_iterator_t<B, E>;
+  using key_type = typename std::iterator_traits<K>::value_type;
+
+  return sort_by_key(
+    std::forward<B>(keys_beg), std::forward<E>(keys_end), 
+    std::forward<V>(vals_beg), std::less<key_type>{}
+  );
+}
+
+// ----------------------------------------------------------------------------
+// tf::Taskflow::argsort
+// ----------------------------------------------------------------------------
+
+// Function: argsort
+template <typename B, typename E, typename P, typename C>
+Task FlowBuilder::argsort(B&& beg, E&& end, P&& perm_beg, C cmp) {
+  
+  using K = stateful_iterator_t<B, E>;
+  using I = stateful_iterator_t<P, P>;
+  using index_type = typename std::iterator_traits<I>::value_type;
+
+  Task task = emplace(
+  [b=std::forward<B>(beg), e=std::forward<E>(end), 
+   p=std::forward<P>(perm_beg), cmp] (Subflow& sf) mutable {
+    
+    // fetch the iterator values
+    K beg = b;
+    K end = e;
+    I perm = p;
+
+    auto perm_end = perm + std::distance(beg, end);
+
+    std::iota(perm, perm_end, index_type{0});
+  
+    parallel_sort(
+      sf, sf._executor.num_workers(), perm, perm_end, 
+      [beg, cmp] (index_type l, index_type r) mutable { 
+        return cmp(beg[l], beg[r]); 
+      }
+    );
+  });  
+
+  return task;
+}
+
+// Function: argsort
+template <typename B, typename E, typename P>
+Task FlowBuilder::argsort(B&& beg, E&& end, P&& perm_beg) {
+  
+  using K = stateful_iterator_t<B, E>;
+  using key_type = typename std::iterator_traits<K>::value_type;
+
+  return argsort(
+    std::forward<B>(beg), std::forward<E>(end), 
+    std::forward<P>(perm_beg), std::less<key_type>{}
+  );
+}
+
 }  // namespace tf ------------------------------------------------------------
 
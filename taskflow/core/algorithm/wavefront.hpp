@@ -0,0 +1,99 @@
+#pragma once
+
+#include "../executor.hpp"
+
+namespace tf {
+
+// ----------------------------------------------------------------------------
+// parallel wavefront
+// ----------------------------------------------------------------------------
+
+// Procedure: parallel_wavefront
+// runs the block (i, j) and keeps running the blocks it makes ready,
+// spawning a new task only when two blocks become ready at the same time
+template <typename I, typename C>
+void parallel_wavefront(
+  Subflow& sf, std::atomic<unsigned char>* deps, size_t R, size_t N,
+  size_t i, size_t j, C& c
+) {
+
+  while(1) {
+
+    c(static_cast<I>(i), static_cast<I>(j));
+
+    bool right = (j + 1 < N) &&
+      deps[i*N + j + 1].fetch_sub(1, std::memory_order_acq_rel) == 1;
+
+    bool down = (i + 1 < R) &&
+      deps[(i + 1)*N + j].fetch_sub(1, std::memory_order_acq_rel) == 1;
+
+    if(right && down) {
+      sf.silent_async([&sf, deps, R, N, i, j, &c] () {
+        parallel_wavefront<I>(sf, deps, R, N, i + 1, j, c);
+      });
+      ++j;
+    }
+    else if(right) {
+      ++j;
+    }
+    else if(down) {
+      ++i;
+    }
+    else {
+      return;
+    }
+  }
+}
+
+// Function: wavefront
+template <typename M, typename N, typename C>
+Task FlowBuilder::wavefront(M&& rows, N&& cols, C c) {
+
+  using I = stateful_index_t<M, N, N>;
+
+  Task task = emplace(
+  [m=std::forward<M>(rows), n=std::forward<N>(cols), c] (Subflow& sf) mutable {
+
+    // fetch the index values
+    I rows = m;
+    I cols = n;
+
+    if(rows <= 0 || cols <= 0) {
+      return;
+    }
+
+    size_t W = sf._executor.num_workers();
+    size_t num_rows = static_cast<size_t>(rows);
+    size_t num_cols = static_cast<size_t>(cols);
+
+    // only myself - no need to spawn another graph
+    if(W <= 1 || num_rows == 1 || num_cols == 1) {
+      for(I i=0; i<rows; i++) {
+        for(I j=0; j<cols; j++) {
+          c(i, j);
+        }
+      }
+      return;
+    }
+
+    // number of unfinished blocks above and to the left of every block
+    std::unique_ptr<std::atomic<unsigned char>[]> deps(
+      new std::atomic<unsigned char>[num_rows*num_cols]
+    );
+
+    for(size_t i=0; i<num_rows; i++) {
+      for(size_t j=0; j<num_cols; j++) {
+        deps[i*num_cols + j].store((i > 0) + (j > 0), std::memory_order_relaxed);
+      }
+    }
+
+    parallel_wavefront<I>(sf, deps.get(), num_rows, num_cols, 0, 0, c);
+
+    sf.join();
+  });
+
+  return task;
+}
+
+}  // end of namespace tf -----------------------------------------------------
+
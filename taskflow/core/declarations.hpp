@@ -4,13 +4,16 @@ namespace tf {
 
 // taskflow
 class AsyncTopology;
+class BulkTopology;
 class Node;
 class Graph;
 class FlowBuilder;
 class Semaphore;
 class Subflow;
+class Runtime;
 class Task;
 class TaskView;
+class TaskGroup;
 class Taskflow;
 class Topology;
 class TopologyBase;
@@ -20,10 +23,17 @@ class ObserverInterface;
 class ChromeTracingObserver;
 class TFProfObserver;
 class TFProfManager;
+class TFProfStreamObserver;
 
 template <typename T>
 class Future;
 
+// pipeline
+class Pipeflow;
+
+template <typename... Ps>
+class Pipeline;
+
 // cudaFlow
 class cudaNode;
 class cudaGraph;
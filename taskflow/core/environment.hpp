@@ -1,6 +1,8 @@
 #pragma once
 
 #define TF_ENABLE_PROFILER "TF_ENABLE_PROFILER"
+#define TF_ENABLE_STREAM_PROFILER "TF_ENABLE_STREAM_PROFILER"
+#define TF_PROFILER_CONTROL "TF_PROFILER_CONTROL"
 
 namespace tf {
 
@@ -27,6 +27,8 @@ class Executor {
 
   friend class FlowBuilder;
   friend class Subflow;
+  friend class Runtime;
+  friend class TaskGroup;
 
   //struct PerThread {
   //  Worker* worker;
@@ -187,6 +189,31 @@ class Executor {
     */
     template<typename P, typename C>
     tf::Future<void> run_until(Taskflow&& taskflow, P&& pred, C&& callable);
+
+    /**
+    @brief runs a taskflow once and waits for it to complete while the 
+           calling thread helps running tasks
+
+    @param taskflow a tf::Taskflow object
+
+    Unlike <tt>run(taskflow).wait()</tt>, which blocks the calling thread
+    until a worker finishes the taskflow, this method makes the calling 
+    thread steal and run tasks of the executor until the run completes.
+    This saves putting the calling thread to sleep and waking it up again, 
+    and adds the calling thread to the workers for the time of the run.
+    
+    @code{.cpp}
+    executor.run_and_wait(taskflow);  // returns when the run completes
+    @endcode
+
+    Called from a worker of the executor, for example inside a task, 
+    the worker keeps running other tasks instead of blocking.
+    Otherwise, one calling thread at a time joins the workers, unless 
+    observers are attached, in which case it waits for the run as usual 
+    so that observers see tasks only on the workers.
+    Other calling threads wait for the run as usual.
+    */
+    void run_and_wait(Taskflow& taskflow);
     
     /**
     @brief wait for all pending graphs to complete
@@ -219,6 +246,49 @@ class Executor {
     */
     int this_worker_id() const;
 
+    /**
+    @brief queries the counters of each worker at the time of this call
+
+    @return a tf::WorkerStats object per worker, indexed by the worker id,
+            followed by one for the threads that run tasks in 
+            tf::Executor::run_and_wait
+
+    The counters are collected only if the macro @c TF_ENABLE_STATS is 
+    defined before including %Taskflow, so a default build pays nothing 
+    for them and returns zero counters.
+    Each worker updates its own counters without synchronization, and 
+    the snapshot of a running executor is therefore only approximate.
+
+    @code{.cpp}
+    #define TF_ENABLE_STATS
+    #include <taskflow/taskflow.hpp>
+
+    for(auto& s : executor.stats()) {
+      std::cout << s.num_tasks_of(tf::TaskType::STATIC) << ' '
+                << s.num_steals << ' ' << s.num_parks << '\n';
+    }
+    @endcode
+    */
+    std::vector<WorkerStats> stats() const;
+
+    /**
+    @brief queries the histogram of the time tasks spent between becoming
+           ready and starting to run, over all workers and the threads that 
+           run tasks in tf::Executor::run_and_wait
+
+    The executor records a task when it becomes ready and again when a
+    worker starts to run it, but only if the macro @c TF_ENABLE_STATS is
+    defined before including %Taskflow. 
+    Otherwise, the histogram is empty.
+    The histogram of each worker is part of tf::Executor::stats.
+
+    @code{.cpp}
+    auto h = executor.latency();
+    std::cout << h.count() << " tasks, p99 " << h.p99().count() << " ns\n";
+    @endcode
+    */
+    LatencyHistogram latency() const;
+
     /** 
     @brief runs a given function asynchronously
 
@@ -241,6 +311,117 @@ class Executor {
     */
     template <typename F, typename... ArgsT>
     void silent_async(F&& f, ArgsT&&... args);
+
+    /**
+    @brief runs <tt>f(0), f(1), ..., f(n-1)</tt> asynchronously as
+           @c n silent asynchronous tasks
+
+    @tparam F callable type
+
+    @param n number of tasks
+    @param f callable object to call with the index of each task
+    
+    Unlike @c n calls to tf::Executor::silent_async, this method creates 
+    the tasks in batches from the task pool, pushes each batch to the
+    queue at once, and counts all tasks as one pending submission 
+    for tf::Executor::wait_for_all.
+    All tasks share one copy of the callable, which is destroyed after
+    the last task finishes.
+
+    @code{.cpp}
+    executor.silent_async_bulk(100000, [&](size_t i){ process(jobs[i]); });
+    executor.wait_for_all();
+    @endcode
+    
+    This method is thread-safe. 
+    */
+    template <typename F>
+    void silent_async_bulk(size_t n, F&& f);
+
+    /**
+    @brief runs @c f on each dereferenced iterator in <tt>[first, last)</tt>
+           asynchronously as one silent asynchronous task per element
+    
+    @tparam I input iterator type
+    @tparam F callable type
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param f callable object to call with each dereferenced iterator
+    
+    This method creates the tasks in one batch like 
+    tf::Executor::silent_async_bulk(size_t, F&&).
+    The range must remain valid until the tasks finish.
+    */
+    template <typename I, typename F>
+    void silent_async_bulk(I first, I last, F&& f);
+    
+    /**
+    @brief runs a parallel loop immediately and waits for it to finish
+
+    @tparam B beginning index or iterator type
+    @tparam E ending index or iterator type
+    @tparam C callable type
+
+    @param first index or iterator to the beginning (inclusive)
+    @param last index or iterator to the end (exclusive)
+    @param callable a callable object to apply to each index or 
+                    dereferenced iterator
+    @param chunk_size minimum number of iterations a thread claims at once
+    
+    Applies the callable to each index in <tt>[first, last)</tt> if the 
+    arguments are integral, or to each dereferenced iterator in 
+    <tt>[first, last)</tt> otherwise.
+    Unlike tf::Taskflow::for_each and tf::Taskflow::for_each_index, 
+    this method needs neither a taskflow nor a run. 
+    The calling thread participates in the loop, and the workers of the 
+    executor claim chunks of iterations using guided scheduling.
+    If the caller is a worker of this executor, it executes other tasks 
+    while waiting for the loop to finish.
+    
+    This method is thread-safe and can be called from any thread, 
+    including the workers of this executor.
+
+    @code{.cpp}
+    std::vector<int> data(100);
+    executor.parallel_for(0, 100, [&](int i){ data[i] = i; });
+    executor.parallel_for(data.begin(), data.end(), [](int& d){ d *= 2; });
+    @endcode
+    */
+    template <typename B, typename E, typename C>
+    void parallel_for(B first, E last, C callable, size_t chunk_size = 1);
+
+    /**
+    @brief runs a parallel reduction immediately and returns its result
+
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam T result type 
+    @tparam O binary reducer type
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param init initial value of the reduction
+    @param bop binary operator that will be applied 
+    @param chunk_size minimum number of elements a thread claims at once
+
+    @return the reduction of @c init and all elements in <tt>[first, last)</tt>
+    
+    Similar to tf::Executor::parallel_for, the calling thread participates in 
+    the reduction and no taskflow is needed.
+    The binary operator must be associative and commutative.
+
+    This method is thread-safe and can be called from any thread, 
+    including the workers of this executor.
+
+    @code{.cpp}
+    std::vector<int> data(100, 1);
+    int sum = executor.parallel_reduce(data.begin(), data.end(), 0, std::plus<int>{});
+    assert(sum == 100);
+    @endcode
+    */
+    template <typename B, typename E, typename T, typename O>
+    T parallel_reduce(B first, E last, T init, O bop, size_t chunk_size = 1);
     
     /**
     @brief constructs an observer to inspect the activities of worker threads
@@ -253,12 +434,23 @@ class Executor {
     @param args arguments to forward to the constructor of the observer
     
     @return a shared pointer to the created observer
+
+    This method is thread-safe and can be called while the executor is
+    running tasks.
+    If the macro @c TF_DISABLE_OBSERVERS is defined before including 
+    %Taskflow, the executor never notifies observers and a task costs
+    nothing for them.
     */
     template <typename Observer, typename... ArgsT>
     std::shared_ptr<Observer> make_observer(ArgsT&&... args);
     
     /**
     @brief removes the associated observer
+
+    This method is thread-safe. 
+    Workers may still notify the observer of events they were dispatching 
+    when the observer was removed, and the executor keeps a reference to 
+    the observer until the executor is destroyed.
     */
     template <typename Observer>
     void remove_observer(std::shared_ptr<Observer> observer);
@@ -279,6 +471,12 @@ class Executor {
     
     std::vector<Worker> _workers;
     std::vector<std::thread> _threads;
+
+    // worker of a thread running tasks in run_and_wait, which schedules 
+    // tasks to the shared queue like any thread outside the executor
+    Worker _caller;
+    std::atomic<bool> _has_caller {false};
+
     std::list<Taskflow> _taskflows;
 
     Notifier _notifier;
@@ -289,12 +487,42 @@ class Executor {
     std::atomic<size_t> _num_thieves {0};
     std::atomic<bool>   _done {0};
     
-    std::unordered_set<std::shared_ptr<ObserverInterface>> _observers;
+    // Workers read the observers through an immutable array, which
+    // make_observer and remove_observer replace as a whole. Each reader 
+    // holds a reference to the array while dispatching events through it, 
+    // and the last reference of a replaced array deletes it together with
+    // the observers no one else owns.
+    struct Observers {
+      mutable std::atomic<size_t> refs {1};
+      std::vector<std::shared_ptr<ObserverInterface>> all;
+      std::vector<ObserverInterface*> tasks;
+      std::vector<ObserverInterface*> steal;
+      std::vector<ObserverInterface*> park;
+      std::vector<ObserverInterface*> ready;
+      std::vector<ObserverInterface*> topology;
+    };
+
+    mutable std::mutex _observer_mutex;
+    std::atomic<const Observers*> _observers {nullptr};
+    std::atomic<size_t> _observer_phase {0};
+    std::atomic<size_t> _observer_readers[2] = {0, 0};
 
     bool _wait_for_task(Worker&, Node*&);
     
-    void _observer_prologue(Worker&, Node*);
-    void _observer_epilogue(Worker&, Node*);
+    const Observers* _observer_prologue(Worker&, Node*);
+    void _observer_epilogue(Worker&, Node*, const Observers*);
+    void _update_observers(std::vector<std::shared_ptr<ObserverInterface>>);
+    bool _has_observers() const;
+    const Observers* _acquire_observers();
+    void _release_observers(const Observers*);
+    void _observe_steal(Worker&, bool);
+    void _observe_park(Worker&);
+    void _observe_unpark(Worker&);
+    void _observe_ready(Node*);
+    void _observe_topology_start(Topology*);
+    void _observe_topology_end(Topology*);
+    void _stamp_ready(Node*);
+    void _record_latency(Worker&, Node*);
     void _spawn(size_t);
     void _worker_loop(Worker&);
     void _exploit_task(Worker&, Node*&);
@@ -302,8 +530,17 @@ class Executor {
     void _schedule(Node*);
     void _schedule(const std::vector<Node*>&);
     void _set_up_topology(Topology*);
+    void _set_up_levels(Graph&);
+    void _start_iterations(Topology*);
+    bool _set_up_iterations(Topology*);
+    std::unique_ptr<Graph> _acquire_clone(Taskflow&);
+    void _add_slot(Topology*);
+    void _tear_down_iterations(Topology*);
+    bool _tear_down_iteration(Topology*);
     void _tear_down_topology(Topology*); 
     void _tear_down_async(Node*);
+    void _tear_down_bulk(Node*);
+    void _release_bulk(BulkTopology*);
     void _tear_down_invoke(Node*, bool);
     void _increment_topology();
     void _decrement_topology();
@@ -313,6 +550,7 @@ class Executor {
     void _invoke_dynamic_task(Worker&, Node*);
     void _invoke_dynamic_task_internal(Worker&, Node*, Graph&, bool);
     void _invoke_dynamic_task_external(Node*, Graph&, bool);
+    void _invoke_runtime_task(Worker&, Node*);
     void _invoke_condition_task(Worker&, Node*, int&);
     void _invoke_module_task(Worker&, Node*);
     void _invoke_async_task(Worker&, Node*);
@@ -320,6 +558,23 @@ class Executor {
     void _invoke_cudaflow_task(Worker&, Node*);
     void _invoke_syclflow_task(Worker&, Node*);
 
+    template <typename P>
+    void _corun_until(Worker&, P&&);
+
+    template <typename P>
+    bool _corun_as_caller(P&&);
+
+    template <typename P>
+    void _wait_until(P&&);
+
+    template <typename C>
+    void _corun_n(size_t, C&);
+
+    size_t _num_coworkers() const;
+
+    template <typename I, typename F>
+    void _parallel_for_chunks(I, I, size_t, F&);
+
     template <typename C, 
       std::enable_if_t<is_cudaflow_task_v<C>, void>* = nullptr
     >
@@ -339,6 +594,13 @@ inline Executor::Executor(size_t N) :
   if(N == 0) {
     TF_THROW("no cpu workers to execute taskflows");
   }
+
+  // the caller steals from the shared queue first
+  _caller._id = N;
+  _caller._vtm = N;
+  _caller._executor = this;
+  _caller._waiter = nullptr;
+  _caller._counters.set_up(N + 1);
   
   _spawn(N);
 
@@ -346,10 +608,23 @@ inline Executor::Executor(size_t N) :
   if(has_env(TF_ENABLE_PROFILER)) {
     TFProfManager::get()._manage(make_observer<TFProfObserver>());
   }
+
+  // instantiate a streaming observer writing to its own files if requested
+  if(has_env(TF_ENABLE_STREAM_PROFILER)) {
+    make_observer<TFProfStreamObserver>(
+      get_env(TF_ENABLE_STREAM_PROFILER) + '.' + 
+      std::to_string(unique_id<size_t>())
+    );
+  }
+
+  // let the profiler attach observers at runtime
+  TFProfManager::get()._register(this);
 }
 
 // Destructor
 inline Executor::~Executor() {
+
+  TFProfManager::get()._unregister(this);
   
   // wait for all topologies to complete
   wait_for_all();
@@ -362,6 +637,9 @@ inline Executor::~Executor() {
   for(auto& t : _threads){
     t.join();
   } 
+
+  std::lock_guard<std::mutex> lock(_observer_mutex);
+  _update_observers({});
 }
 
 // Function: num_workers
@@ -432,10 +710,118 @@ void Executor::silent_async(F&& f, ArgsT&&... args) {
   _schedule(node);
 }
 
+// Function: silent_async_bulk
+template <typename F>
+void Executor::silent_async_bulk(size_t n, F&& f) {
+
+  if(n == 0) {
+    return;
+  }
+
+  // the last task to tear down deletes the bulk, which releases the 
+  // callable and then the submission
+  struct Submission {
+    Executor& executor;
+    ~Submission() { executor._decrement_topology_and_notify(); }
+  };
+
+  struct Bulk : public BulkTopology {
+    Bulk(Executor& e, F&& f) : submission {e}, callable {std::forward<F>(f)} {}
+    Submission submission;
+    std::decay_t<F> callable;
+  };
+
+  _increment_topology();
+
+  auto bulk = new Bulk(*this, std::forward<F>(f));
+  bulk->_pending.store(n, std::memory_order_relaxed);
+
+  // creates and schedules the tasks in chunks so that workers can start
+  // on the first chunk while the rest are being created
+  std::vector<Node*> nodes(std::min(n, size_t{1024}));
+
+  for(size_t beg=0; beg<n; beg+=nodes.size()) {
+
+    nodes.resize(std::min(nodes.size(), n - beg));
+
+    // a trivially copyable closure stays in the local buffer of std::function
+    node_pool.animate_n(nodes.data(), nodes.size(), [bulk, beg] (size_t i) {
+      return std::make_tuple(
+        std::in_place_type_t<Node::SilentAsync>{}, 
+        [bulk, i=beg+i] () { bulk->callable(i); },
+        static_cast<BulkTopology*>(bulk)
+      );
+    });
+
+    _schedule(nodes);
+  }
+}
+
+// Function: silent_async_bulk
+template <typename I, typename F>
+void Executor::silent_async_bulk(I first, I last, F&& f) {
+  using category = typename std::iterator_traits<I>::iterator_category;
+  if constexpr(std::is_base_of_v<std::random_access_iterator_tag, category>) {
+    silent_async_bulk(
+      static_cast<size_t>(std::distance(first, last)),
+      [first, f=std::forward<F>(f)] (size_t i) mutable { f(first[i]); }
+    );
+  }
+  else {
+    std::vector<I> itrs;
+    for(; first != last; ++first) {
+      itrs.push_back(first);
+    }
+    const size_t n = itrs.size();
+    silent_async_bulk(
+      n, [itrs=std::move(itrs), f=std::forward<F>(f)] (size_t i) mutable { 
+        f(*itrs[i]); 
+      }
+    );
+  }
+}
+
 // Function: this_worker_id
 inline int Executor::this_worker_id() const {
   Worker* worker = this_worker().worker;
-  return worker ? static_cast<int>(worker->_id) : -1;
+  return (worker && worker != &_caller) ? static_cast<int>(worker->_id) : -1;
+}
+
+// Function: stats
+inline std::vector<WorkerStats> Executor::stats() const {
+  std::vector<WorkerStats> stats;
+  stats.reserve(_workers.size() + 1);
+  for(auto& w : _workers) {
+    stats.push_back(w._counters.stats());
+  }
+  stats.push_back(_caller._counters.stats());
+  return stats;
+}
+
+// Function: latency
+inline LatencyHistogram Executor::latency() const {
+  LatencyHistogram latency;
+  for(auto& w : _workers) {
+    latency.merge(w._counters.stats().latency);
+  }
+  latency.merge(_caller._counters.stats().latency);
+  return latency;
+}
+
+// Procedure: _stamp_ready
+inline void Executor::_stamp_ready([[maybe_unused]] Node* node) {
+#ifdef TF_ENABLE_STATS
+  node->_ready_time = std::chrono::steady_clock::now();
+#endif
+}
+
+// Procedure: _record_latency
+inline void Executor::_record_latency(
+  [[maybe_unused]] Worker& worker, [[maybe_unused]] Node* node
+) {
+#ifdef TF_ENABLE_STATS
+  worker._counters.latency(std::chrono::steady_clock::now() - node->_ready_time);
+#endif
 }
 
 // Procedure: _spawn
@@ -446,6 +832,7 @@ inline void Executor::_spawn(size_t N) {
     _workers[id]._vtm = id;
     _workers[id]._executor = this;
     _workers[id]._waiter = &_notifier._waiters[id];
+    _workers[id]._counters.set_up(N + 1);
     
     _threads.emplace_back([this] (Worker& w) -> void {
 
@@ -484,11 +871,17 @@ inline void Executor::_explore_task(Worker& w, Node*& t) {
   do {
     t = (w._id == w._vtm) ? _wsq.steal() : _workers[w._vtm]._wsq.steal();
 
+    _observe_steal(w, t != nullptr);
+
     if(t) {
+      w._counters.steal(w._id == w._vtm ? _workers.size() : w._vtm);
       break;
     }
+
+    w._counters.failed_steal();
     
     if(num_steals++ > max_steals) {
+      w._counters.yield();
       std::this_thread::yield();
       if(num_yields++ > 100) {
         break;
@@ -582,8 +975,14 @@ inline bool Executor::_wait_for_task(Worker& worker, Node*& t) {
   }
     
   // Now I really need to relinguish my self to others
+  worker._counters.park();
+  _observe_park(worker);
+
   _notifier.commit_wait(worker._waiter);
 
+  worker._counters.unpark();
+  _observe_unpark(worker);
+
   return true;
 }
 
@@ -601,7 +1000,17 @@ std::shared_ptr<Observer> Executor::make_observer(ArgsT&&... args) {
   
   ptr->set_up(_workers.size());
 
-  _observers.emplace(std::static_pointer_cast<ObserverInterface>(ptr));
+  static_cast<ObserverInterface*>(ptr.get())->_events = 
+    observer_events<Observer>();
+
+  std::lock_guard<std::mutex> lock(_observer_mutex);
+
+  auto observers = _observers.load(std::memory_order_relaxed);
+  auto all = observers ? observers->all : 
+                         std::vector<std::shared_ptr<ObserverInterface>>{};
+  all.push_back(std::static_pointer_cast<ObserverInterface>(ptr));
+
+  _update_observers(std::move(all));
 
   return ptr;
 }
@@ -615,12 +1024,121 @@ void Executor::remove_observer(std::shared_ptr<Observer> ptr) {
     "Observer must be derived from ObserverInterface"
   );
 
-  _observers.erase(std::static_pointer_cast<ObserverInterface>(ptr));
+  std::lock_guard<std::mutex> lock(_observer_mutex);
+
+  auto observers = _observers.load(std::memory_order_relaxed);
+
+  if(observers == nullptr) {
+    return;
+  }
+
+  auto all = observers->all;
+  all.erase(
+    std::remove(all.begin(), all.end(), 
+                std::static_pointer_cast<ObserverInterface>(ptr)),
+    all.end()
+  );
+
+  if(all.size() != observers->all.size()) {
+    _update_observers(std::move(all));
+  }
 }
 
 // Function: num_observers
 inline size_t Executor::num_observers() const {
-  return _observers.size();
+  std::lock_guard<std::mutex> lock(_observer_mutex);
+  auto observers = _observers.load(std::memory_order_relaxed);
+  return observers ? observers->all.size() : 0;
+}
+
+// Procedure: _update_observers
+// publishes a new array of the given observers and drops the executor's
+// reference to the replaced one
+inline void Executor::_update_observers(
+  std::vector<std::shared_ptr<ObserverInterface>> all
+) {
+
+  // ---- under observer lock ----
+
+  std::unique_ptr<Observers> observers;
+
+  if(!all.empty()) {
+    observers = std::make_unique<Observers>();
+  }
+
+  for(auto& observer : all) {
+    auto o = observer.get();
+    observers->tasks.push_back(o);
+    if(o->_events & OBSERVE_STEAL) {
+      observers->steal.push_back(o);
+    }
+    if(o->_events & OBSERVE_PARK) {
+      observers->park.push_back(o);
+    }
+    if(o->_events & OBSERVE_READY) {
+      observers->ready.push_back(o);
+    }
+    if(o->_events & OBSERVE_TOPOLOGY) {
+      observers->topology.push_back(o);
+    }
+  }
+  
+  if(observers) {
+    observers->all = std::move(all);
+  }
+
+  auto old = _observers.exchange(observers.release());
+
+  // A reader may have loaded the old array without holding its reference 
+  // yet. Readers announce themselves in the counter of the current phase,
+  // so after flipping the phase twice and waiting for both counters to 
+  // drain, no reader can still be between the load and the reference.
+  for(size_t i=0; i<2; ++i) {
+    auto phase = _observer_phase.fetch_add(1);
+    while(_observer_readers[phase & 1].load() != 0) {
+      std::this_thread::yield();
+    }
+  }
+
+  _release_observers(old);
+}
+
+// Function: _has_observers
+inline bool Executor::_has_observers() const {
+#ifdef TF_DISABLE_OBSERVERS
+  return false;
+#else
+  return _observers.load(std::memory_order_acquire) != nullptr;
+#endif
+}
+
+// Function: _acquire_observers
+// returns a reference to the current observers, or nullptr if there is 
+// none to notify
+inline const Executor::Observers* Executor::_acquire_observers() {
+#ifdef TF_DISABLE_OBSERVERS
+  return nullptr;
+#else
+  if(_observers.load(std::memory_order_relaxed) == nullptr) {
+    return nullptr;
+  }
+  auto& readers = _observer_readers[_observer_phase.load() & 1];
+  readers.fetch_add(1);
+  auto observers = _observers.load();
+  if(observers) {
+    observers->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+  readers.fetch_sub(1);
+  return observers;
+#endif
+}
+
+// Procedure: _release_observers
+// drops a reference to the observers and deletes them with the last one
+inline void Executor::_release_observers(const Observers* observers) {
+  if(observers && observers->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete observers;
+  }
 }
 
 // Procedure: _schedule
@@ -630,13 +1148,19 @@ inline void Executor::_schedule(Node* node) {
   
   //assert(_workers.size() != 0);
   
+  _stamp_ready(node);
+  
   node->_state.fetch_or(Node::READY, std::memory_order_release);
 
+  // the node may be gone as soon as it is in a queue
+  _observe_ready(node);
+
   // caller is a worker to this pool
   auto worker = this_worker().worker;
 
-  if(worker != nullptr && worker->_executor == this) {
+  if(worker != nullptr && worker->_executor == this && worker != &_caller) {
     worker->_wsq.push(node);
+    worker->_counters.queue_size(worker->_wsq.size());
     return;
   }
 
@@ -666,16 +1190,27 @@ inline void Executor::_schedule(const std::vector<Node*>& nodes) {
   
   // make the node ready
   for(size_t i=0; i<num_nodes; ++i) {
+    _stamp_ready(nodes[i]);
     nodes[i]->_state.fetch_or(Node::READY, std::memory_order_release);
   }
 
+  if(auto observers = _acquire_observers(); observers) {
+    for(size_t i=0; i<num_nodes; ++i) {
+      for(auto observer : observers->ready) {
+        observer->on_ready(TaskView(*nodes[i]));
+      }
+    }
+    _release_observers(observers);
+  }
+
   // worker thread
   auto worker = this_worker().worker;
 
-  if(worker != nullptr && worker->_executor == this) {
+  if(worker != nullptr && worker->_executor == this && worker != &_caller) {
     for(size_t i=0; i<num_nodes; ++i) {
       worker->_wsq.push(nodes[i]);
     }
+    worker->_counters.queue_size(worker->_wsq.size());
     return;
   }
   
@@ -695,12 +1230,21 @@ inline void Executor::_invoke(Worker& worker, Node* node) {
   
   // synchronize all outstanding memory operations caused by reordering
   while(!(node->_state.load(std::memory_order_acquire) & Node::READY));
+
+  _record_latency(worker, node);
   
-  // no need to do other things if the topology is cancelled
+  // no need to do other things if the topology is cancelled, except that 
+  // a task of ordered iterations still waits for its token and passes it 
+  // on to the next iteration, which might be waiting for it
   //if(node->_topology && node->_topology->_is_cancelled) {
-  if(node->_is_cancelled()) {
-    _tear_down_invoke(node, true);
-    return;
+  const bool cancelled = node->_is_cancelled();
+
+  if(cancelled) {
+    auto t = node->_topology;
+    if(!(t && t->_run && !t->_run->_tokens.empty())) {
+      _tear_down_invoke(node, true);
+      return;
+    }
   }
 
   // if acquiring semaphore(s) exists, acquire them first
@@ -714,6 +1258,14 @@ inline void Executor::_invoke(Worker& worker, Node* node) {
     node->_state.fetch_or(Node::ACQUIRED, std::memory_order_release);
   }
 
+  if(cancelled) {
+    _schedule(node->_release_all());
+    _tear_down_invoke(node, true);
+    return;
+  }
+
+  worker._counters.task(TaskView(*node).type());
+
   // Here we need to fetch the num_successors first to avoid the invalid memory
   // access caused by topology clear.
   const auto num_successors = node->num_successors();
@@ -735,6 +1287,12 @@ inline void Executor::_invoke(Worker& worker, Node* node) {
     }
     break;
     
+    // runtime task
+    case Node::RUNTIME: {
+      _invoke_runtime_task(worker, node);
+    }
+    break;
+    
     // condition task
     case Node::CONDITION: {
       _invoke_condition_task(worker, node, cond);
@@ -803,12 +1361,30 @@ inline void Executor::_invoke(Worker& worker, Node* node) {
   // At this point, the node storage might be destructed (to be verified)
   // case 1: non-condition task
   if(node->_handle.index() != Node::CONDITION) {
+    
+    // The successor of the largest level (see critical-path scheduling) 
+    // is scheduled last, so this worker continues with it and leaves the
+    // other successors to thieves.
+    Node* next = nullptr;
+
     for(size_t i=0; i<num_successors; ++i) {
-      if(--(node->_successors[i]->_join_counter) == 0) {
+      if(auto s = node->_successors[i]; --(s->_join_counter) == 0) {
         j.fetch_add(1);
-        _schedule(node->_successors[i]);
+        if(next && s->_level < next->_level) {
+          _schedule(s);
+        }
+        else {
+          if(next) {
+            _schedule(next);
+          }
+          next = s;
+        }
       }
     }
+
+    if(next) {
+      _schedule(next);
+    }
   }
   // case 2: condition task
   else {
@@ -835,6 +1411,36 @@ inline void Executor::_tear_down_async(Node* node) {
   node_pool.recycle(node);
 }
 
+// Procedure: _tear_down_bulk
+inline void Executor::_tear_down_bulk(Node* node) {
+  auto bulk = std::get<Node::SilentAsync>(node->_handle).bulk;
+  node_pool.recycle(node);
+  _release_bulk(bulk);
+}
+
+// Procedure: _release_bulk
+inline void Executor::_release_bulk(BulkTopology* bulk) {
+
+  // a group may delete its state as soon as its last task is released
+  bool is_group = bulk->_is_group;
+
+  switch(bulk->_pending.fetch_sub(1, std::memory_order_acq_rel)) {
+    case 1:
+      delete bulk;
+    break;
+
+    // the last pending task of a group ends the submission of the group
+    case 2:
+      if(is_group) {
+        _decrement_topology_and_notify();
+      }
+    break;
+
+    default:
+    break;
+  }
+}
+
 // Procedure: _tear_down_invoke
 inline void Executor::_tear_down_invoke(Node* node, bool cancel) {
 
@@ -849,7 +1455,12 @@ inline void Executor::_tear_down_invoke(Node* node, bool cancel) {
 
     // silent async doesn't need to carry out the promise
     case Node::SILENT_ASYNC:
-      _tear_down_async(node);
+      if(std::get<Node::SilentAsync>(node->_handle).bulk) {
+        _tear_down_bulk(node);
+      }
+      else {
+        _tear_down_async(node);
+      }
     break;
 
     // tear down topology if the node is the last leaf
@@ -867,31 +1478,116 @@ inline void Executor::_tear_down_invoke(Node* node, bool cancel) {
   }
 }
 
-// Procedure: _observer_prologue
-inline void Executor::_observer_prologue(Worker& worker, Node* node) {
-  for(auto& observer : _observers) {
-    observer->on_entry(WorkerView(worker), TaskView(*node));
+// Function: _observer_prologue
+// returns the observers that saw the entry of the task, so that the same
+// observers see its exit even if an observer is added or removed meanwhile
+inline const Executor::Observers* Executor::_observer_prologue(
+  Worker& worker, Node* node
+) {
+  auto observers = _acquire_observers();
+  if(observers) {
+    for(auto observer : observers->tasks) {
+      observer->on_entry(WorkerView(worker), TaskView(*node));
+    }
   }
+  return observers;
 }
 
 // Procedure: _observer_epilogue
-inline void Executor::_observer_epilogue(Worker& worker, Node* node) {
-  for(auto& observer : _observers) {
-    observer->on_exit(WorkerView(worker), TaskView(*node));
+// notifies the observers returned by the prologue and drops their reference
+inline void Executor::_observer_epilogue(
+  Worker& worker, Node* node, const Observers* observers
+) {
+  if(observers) {
+    for(auto observer : observers->tasks) {
+      observer->on_exit(WorkerView(worker), TaskView(*node));
+    }
+    _release_observers(observers);
+  }
+}
+
+// Procedure: _observe_steal
+inline void Executor::_observe_steal(Worker& worker, bool success) {
+  if(auto observers = _acquire_observers(); observers) {
+    auto victim = (worker._id == worker._vtm) ? _workers.size() : worker._vtm;
+    for(auto observer : observers->steal) {
+      observer->on_steal(WorkerView(worker), victim, success);
+    }
+    _release_observers(observers);
+  }
+}
+
+// Procedure: _observe_park
+inline void Executor::_observe_park(Worker& worker) {
+  if(auto observers = _acquire_observers(); observers) {
+    for(auto observer : observers->park) {
+      observer->on_park(WorkerView(worker));
+    }
+    _release_observers(observers);
+  }
+}
+
+// Procedure: _observe_unpark
+inline void Executor::_observe_unpark(Worker& worker) {
+  if(auto observers = _acquire_observers(); observers) {
+    for(auto observer : observers->park) {
+      observer->on_unpark(WorkerView(worker));
+    }
+    _release_observers(observers);
+  }
+}
+
+// Procedure: _observe_ready
+inline void Executor::_observe_ready(Node* node) {
+  if(auto observers = _acquire_observers(); observers) {
+    for(auto observer : observers->ready) {
+      observer->on_ready(TaskView(*node));
+    }
+    _release_observers(observers);
+  }
+}
+
+// Procedure: _observe_topology_start
+inline void Executor::_observe_topology_start(Topology* tpg) {
+  if(auto observers = _acquire_observers(); observers) {
+    for(auto observer : observers->topology) {
+      observer->on_topology_start(tpg->_taskflow);
+    }
+    _release_observers(observers);
+  }
+}
+
+// Procedure: _observe_topology_end
+inline void Executor::_observe_topology_end(Topology* tpg) {
+  if(auto observers = _acquire_observers(); observers) {
+    for(auto observer : observers->topology) {
+      observer->on_topology_end(tpg->_taskflow);
+    }
+    _release_observers(observers);
   }
 }
 
 // Procedure: _invoke_static_task
 inline void Executor::_invoke_static_task(Worker& worker, Node* node) {
-  _observer_prologue(worker, node);
-  std::get<Node::Static>(node->_handle).work();
-  _observer_epilogue(worker, node);
+  
+  auto& handle = std::get<Node::Static>(node->_handle);
+
+  auto observers = _observer_prologue(worker, node);
+  handle.work();
+  _observer_epilogue(worker, node, observers);
+
+  // fused tasks are still observed as individual tasks
+  for(auto f : handle.fused) {
+    auto fused_observers = _observer_prologue(worker, f);
+    std::get<Node::Static>(f->_handle).work();
+    _observer_epilogue(worker, f, fused_observers);
+  }
 }
 
 // Procedure: _invoke_dynamic_task
 inline void Executor::_invoke_dynamic_task(Worker& w, Node* node) {
 
-  _observer_prologue(w, node);
+  auto observers = _observer_prologue(w, node);
 
   auto& handle = std::get<Node::Dynamic>(node->_handle);
 
@@ -905,7 +1601,7 @@ inline void Executor::_invoke_dynamic_task(Worker& w, Node* node) {
     _invoke_dynamic_task_internal(w, node, handle.subgraph, false);
   }
   
-  _observer_epilogue(w, node);
+  _observer_epilogue(w, node, observers);
 }
 
 // Procedure: _invoke_dynamic_task_external
@@ -954,7 +1650,7 @@ inline void Executor::_invoke_dynamic_task_internal(
     
     {
       std::lock_guard<std::mutex> lock(p->_topology->_taskflow._mutex);
-      p->_topology->_taskflow._graph.merge(std::move(g));
+      p->_topology->_graph().merge(std::move(g));
     }
 
     p->_topology->_join_counter.fetch_add(src.size());
@@ -964,81 +1660,195 @@ inline void Executor::_invoke_dynamic_task_internal(
   else {  
     p->_join_counter.fetch_add(src.size());
     _schedule(src);
-    Node* t = nullptr;
+    _corun_until(w, [p] () { return p->_join_counter == 0; });
+  }
+}
+
+// Procedure: _corun_until
+// keeps the worker executing tasks until the predicate becomes true
+template <typename P>
+void Executor::_corun_until(Worker& w, P&& stop_predicate) {
+
+  Node* t = nullptr;
   
-    std::uniform_int_distribution<size_t> rdvtm(0, _workers.size()-1);
+  // the caller of run_and_wait also picks itself to steal from the 
+  // shared queue
+  std::uniform_int_distribution<size_t> rdvtm(
+    0, std::max(w._id, _workers.size() - 1)
+  );
 
-    while(p->_join_counter != 0) {
+  while(!stop_predicate()) {
 
-      t = w._wsq.pop();
+    t = w._wsq.pop();
 
-      exploit:
+    exploit:
 
+    if(t) {
+      _invoke(w, t);
+    }
+    else {
+      explore:
+      t = (w._id == w._vtm) ? _wsq.steal() : _workers[w._vtm]._wsq.steal();
+      _observe_steal(w, t != nullptr);
       if(t) {
-        _invoke(w, t);
+        w._counters.steal(w._id == w._vtm ? _workers.size() : w._vtm);
+        goto exploit;
+      }
+      else if(!stop_predicate()) {
+        w._counters.failed_steal();
+        w._counters.yield();
+        std::this_thread::yield();
+        w._vtm = rdvtm(w._rdgen);
+        goto explore;
       }
       else {
-        explore:
-        t = (w._id == w._vtm) ? _wsq.steal() : _workers[w._vtm]._wsq.steal();
-        if(t) {
-          goto exploit;
-        }
-        else if(p->_join_counter != 0){
-          std::this_thread::yield();
-          w._vtm = rdvtm(w._rdgen);
-          goto explore;
-        }
-        else {
-          break;
-        }
+        break;
       }
     }
   }
 }
 
+// Function: _num_coworkers
+// number of threads that can run work with the caller, including the caller
+inline size_t Executor::_num_coworkers() const {
+  Worker* worker = this_worker().worker;
+  return (worker && worker->_executor == this) ? _workers.size() : 
+                                                 _workers.size() + 1;
+}
+
+// Procedure: _corun_n
+// runs callable(0), ..., callable(N-1) in parallel with the calling thread
+// running callable(0), and returns after all invocations have finished;
+// the callable must be such that invocations that do not run are no loss,
+// e.g., because the running invocations claim all work from a shared state
+template <typename C>
+void Executor::_corun_n(size_t N, C& callable) {
+
+  if(N == 0) {
+    return;
+  }
+
+  if(N == 1) {
+    callable(size_t{0});
+    return;
+  }
+
+  // Helpers register as running before they invoke the callable. Once the 
+  // caller has finished its own invocation, it closes the registration, 
+  // so helpers that have not started yet return without invoking the 
+  // callable, and waits only for the running helpers.
+  // The state is shared by the helpers and the caller, and the last of 
+  // them to release it deletes it.
+  // A caller that can run no tasks of this executor blocks until the last
+  // running helper wakes it up.
+  struct Helpers : public BulkTopology {
+    Helpers(C& c) : callable {c} {}
+    C& callable;
+    std::atomic<size_t> running {0};
+    std::mutex mutex;
+    std::condition_variable cv;
+  };
+
+  constexpr size_t closed = 
+    size_t{1} << (std::numeric_limits<size_t>::digits - 1);
+
+  auto helpers = new Helpers(callable);
+  helpers->_pending.store(N, std::memory_order_relaxed);
+
+  std::vector<Node*> nodes(N - 1);
+
+  node_pool.animate_n(nodes.data(), N - 1, [helpers] (size_t i) {
+    return std::make_tuple(
+      std::in_place_type_t<Node::SilentAsync>{},
+      [helpers, i=i+1] () {
+        auto r = helpers->running.fetch_add(1, std::memory_order_acquire);
+        if((r & closed) == 0) {
+          helpers->callable(i);
+        }
+        r = helpers->running.fetch_sub(1, std::memory_order_release);
+        if(r == closed + 1) {
+          std::lock_guard<std::mutex> lock(helpers->mutex);
+          helpers->cv.notify_one();
+        }
+      },
+      static_cast<BulkTopology*>(helpers)
+    );
+  });
+
+  _schedule(nodes);
+
+  callable(size_t{0});
+
+  helpers->running.fetch_add(closed, std::memory_order_acq_rel);
+
+  auto stop = [helpers] () {
+    return helpers->running.load(std::memory_order_acquire) == closed;
+  };
+
+  Worker* worker = this_worker().worker;
+
+  if(worker && worker->_executor == this) {
+    _corun_until(*worker, stop);
+  }
+  else if(!_corun_as_caller(stop)) {
+    std::unique_lock<std::mutex> lock(helpers->mutex);
+    helpers->cv.wait(lock, stop);
+  }
+
+  _release_bulk(helpers);
+}
+
+// Procedure: _invoke_runtime_task
+inline void Executor::_invoke_runtime_task(Worker& w, Node* node) {
+  auto observers = _observer_prologue(w, node);
+  Runtime rt(*this, w, node);
+  std::get<Node::Runtime>(node->_handle).work(rt);
+  _observer_epilogue(w, node, observers);
+}
+
 // Procedure: _invoke_condition_task
 inline void Executor::_invoke_condition_task(
   Worker& worker, Node* node, int& cond
 ) {
-  _observer_prologue(worker, node);
+  auto observers = _observer_prologue(worker, node);
   cond = std::get<Node::Condition>(node->_handle).work();
-  _observer_epilogue(worker, node);
+  _observer_epilogue(worker, node, observers);
 }
 
 // Procedure: _invoke_cudaflow_task
 inline void Executor::_invoke_cudaflow_task(Worker& worker, Node* node) {
-  _observer_prologue(worker, node);  
+  auto observers = _observer_prologue(worker, node);
   std::get<Node::cudaFlow>(node->_handle).work(*this, node);
-  _observer_epilogue(worker, node);
+  _observer_epilogue(worker, node, observers);
 }
 
 // Procedure: _invoke_syclflow_task
 inline void Executor::_invoke_syclflow_task(Worker& worker, Node* node) {
-  _observer_prologue(worker, node);  
+  auto observers = _observer_prologue(worker, node);
   std::get<Node::syclFlow>(node->_handle).work(*this, node);
-  _observer_epilogue(worker, node);
+  _observer_epilogue(worker, node, observers);
 }
 
 // Procedure: _invoke_module_task
 inline void Executor::_invoke_module_task(Worker& w, Node* node) {
-  _observer_prologue(w, node);
+  auto observers = _observer_prologue(w, node);
   auto module = std::get<Node::Module>(node->_handle).module;
   _invoke_dynamic_task_internal(w, node, module->_graph, false);
-  _observer_epilogue(w, node);  
+  _observer_epilogue(w, node, observers);
 }
 
 // Procedure: _invoke_async_task
 inline void Executor::_invoke_async_task(Worker& w, Node* node) {
-  _observer_prologue(w, node);
+  auto observers = _observer_prologue(w, node);
   std::get<Node::Async>(node->_handle).work(false);
-  _observer_epilogue(w, node);  
+  _observer_epilogue(w, node, observers);
 }
 
 // Procedure: _invoke_silent_async_task
 inline void Executor::_invoke_silent_async_task(Worker& w, Node* node) {
-  _observer_prologue(w, node);
+  auto observers = _observer_prologue(w, node);
   std::get<Node::SilentAsync>(node->_handle).work();
-  _observer_epilogue(w, node);  
+  _observer_epilogue(w, node, observers);
 }
 
 // Function: run
@@ -1133,6 +1943,30 @@ tf::Future<void> Executor::run_until(Taskflow& f, P&& p, C&& c) {
   // modifying topology needs to be protected under the lock
   {
     std::lock_guard<std::mutex> lock(f._mutex);
+
+    // the graph may have been modified since the taskflow was last running
+    if(f._topologies.empty() && f._concurrent_topologies.empty()) {
+      f._clones.clear();
+      if(f._max_concurrent_runs > 1 || f._max_overlapping_iterations > 1) {
+        if(auto node = f._graph._find_unclonable(); node) {
+          _decrement_topology_and_notify();
+          TF_THROW(
+            "task '", node->_name, "' of taskflow '", f._name, 
+            "' cannot run concurrently with itself"
+          );
+        }
+      }
+    }
+
+    // run on a private copy of the graph if another run is active
+    if(!f._topologies.empty() && 
+       f._concurrent_topologies.size() + 1 < f._max_concurrent_runs) {
+      t->_clone = _acquire_clone(f);
+      f._concurrent_topologies.push_back(t);
+      _set_up_topology(t.get());
+      return future;
+    }
+
     f._topologies.push(t);
     if(f._topologies.size() == 1) {
       _set_up_topology(t.get());
@@ -1157,6 +1991,65 @@ tf::Future<void> Executor::run_until(Taskflow&& f, P&& pred, C&& c) {
   return run_until(*itr, std::forward<P>(pred), std::forward<C>(c));
 }
 
+// Procedure: run_and_wait
+inline void Executor::run_and_wait(Taskflow& f) {
+
+  std::atomic<bool> done {false};
+
+  auto future = run(f, [&done] () { 
+    done.store(true, std::memory_order_release); 
+  });
+
+  auto stop = [&done] () { return done.load(std::memory_order_acquire); };
+  
+  // a worker of this executor keeps running tasks
+  if(auto w = this_worker().worker; w && w->_executor == this) {
+    _corun_until(*w, stop);
+  }
+  else {
+    _corun_as_caller(stop);
+  }
+
+  // the run tears down the topology after invoking the callback
+  future.wait();
+}
+
+// Function: _corun_as_caller
+// lets a thread outside the executor run tasks as the caller worker until 
+// the predicate becomes true, and returns false without running any task 
+// if another thread is the caller or an observer expects every task to 
+// run on one of the workers
+template <typename P>
+bool Executor::_corun_as_caller(P&& stop) {
+
+  if(_has_observers() || 
+     _has_caller.exchange(true, std::memory_order_acquire)) {
+    return false;
+  }
+
+  auto prev = std::exchange(this_worker().worker, &_caller);
+  _corun_until(_caller, stop);
+  this_worker().worker = prev;
+  _has_caller.store(false, std::memory_order_release);
+
+  return true;
+}
+
+// Procedure: _wait_until
+// runs tasks until the predicate becomes true, or yields if the calling 
+// thread cannot run tasks of this executor
+template <typename P>
+void Executor::_wait_until(P&& stop) {
+  if(auto w = this_worker().worker; w && w->_executor == this) {
+    _corun_until(*w, stop);
+  }
+  else if(!_corun_as_caller(stop)) {
+    while(!stop()) {
+      std::this_thread::yield();
+    }
+  }
+}
+
 // Procedure: _increment_topology
 inline void Executor::_increment_topology() {
   std::lock_guard<std::mutex> lock(_topology_mutex);
@@ -1188,11 +2081,26 @@ inline void Executor::_set_up_topology(Topology* tpg) {
 
   // ---- under taskflow lock ----
 
+  if(tpg->_run == nullptr) {
+    _observe_topology_start(tpg);
+  }
+
+  if(tpg->_run == nullptr && tpg->_taskflow._max_overlapping_iterations > 1 && 
+     _set_up_iterations(tpg)) {
+    return;
+  }
+
+  auto& g = tpg->_graph();
+
   tpg->_sources.clear();
-  tpg->_taskflow._graph.clear_detached();
+  g.clear_detached();
+
+  if(tpg->_taskflow._critical_path_scheduling) {
+    _set_up_levels(g);
+  }
   
   // scan each node in the graph and build up the links
-  for(auto node : tpg->_taskflow._graph._nodes) {
+  for(auto node : g._nodes) {
     
     node->_topology = tpg;
     node->_state.store(0, std::memory_order_relaxed);
@@ -1208,15 +2116,248 @@ inline void Executor::_set_up_topology(Topology* tpg) {
   _schedule(tpg->_sources);
 }
 
+// Function: _acquire_clone
+// takes a copy of the graph of a taskflow from its pool or creates one
+inline std::unique_ptr<Graph> Executor::_acquire_clone(Taskflow& f) {
+
+  // ---- under taskflow lock ----
+
+  if(f._clones.empty()) {
+    auto g = std::make_unique<Graph>();
+    f._graph._clone(*g);
+    return g;
+  }
+
+  auto g = std::move(f._clones.back());
+  f._clones.pop_back();
+  g->clear_detached();
+  return g;
+}
+
+// Procedure: _add_slot
+// adds a slot to a run with overlapping iterations
+inline void Executor::_add_slot(Topology* tpg) {
+  
+  // ---- under taskflow lock ----
+
+  auto slot = std::make_unique<Topology>(tpg->_taskflow, nullptr, nullptr);
+  if(!tpg->_slots.empty()) {
+    slot->_clone = _acquire_clone(tpg->_taskflow);
+  }
+  slot->_run = tpg;
+  tpg->_slots.push_back(std::move(slot));
+}
+
+// Function: _set_up_iterations
+// sets up a run whose iterations overlap on copies of the graph; returns 
+// false if its tasks cannot be ordered
+inline bool Executor::_set_up_iterations(Topology* tpg) {
+
+  // ---- under taskflow lock ----
+
+  auto& f = tpg->_taskflow;
+  auto& g = tpg->_graph();
+  
+  const size_t K = f._max_overlapping_iterations;
+  
+  g.clear_detached();
+
+  if(f._ordered_iterations) {
+    for(auto node : g._nodes) {
+      if(node->_handle.index() == Node::CONDITION) {
+        return false;
+      }
+    }
+  }
+
+  tpg->_slots.clear();
+  tpg->_tokens.clear();
+  tpg->_num_iterations = 0;
+  tpg->_is_stopped = false;
+
+  // the slots are added once their first iterations start, except that
+  // ordered iterations wire the tokens into all slots up front:
+  // task i of slot s acquires token i*K + s and releases the token of the 
+  // next slot, and iteration 0 holds all tokens
+  if(f._ordered_iterations) {
+    
+    for(size_t s=0; s<K; s++) {
+      _add_slot(tpg);
+    }
+    
+    const size_t N = g._nodes.size();
+
+    for(size_t i=0; i<N; i++) {
+      for(size_t s=0; s<K; s++) {
+        tpg->_tokens.emplace_back(s == 0 ? 1 : 0);
+      }
+    }
+
+    for(size_t s=0; s<K; s++) {
+      auto& nodes = tpg->_slots[s]->_graph()._nodes;
+      for(size_t i=0; i<N; i++) {
+        if(!nodes[i]->_semaphores) {
+          nodes[i]->_semaphores = std::make_unique<Node::Semaphores>();
+        }
+        nodes[i]->_semaphores->to_acquire.push_back(&tpg->_tokens[i*K + s]);
+        nodes[i]->_semaphores->to_release.push_back(
+          &tpg->_tokens[i*K + (s + 1) % K]
+        );
+      }
+    }
+  }
+
+  tpg->_join_counter = 0;
+  _start_iterations(tpg);
+
+  return true;
+}
+
+// Procedure: _start_iterations
+// starts the next iterations of a run in order while their slots are idle 
+// and the predicate allows
+inline void Executor::_start_iterations(Topology* tpg) {
+
+  // ---- under taskflow lock ----
+  
+  const size_t K = tpg->_taskflow._max_overlapping_iterations;
+
+  while(!tpg->_is_stopped) {
+
+    const size_t s = tpg->_num_iterations % K;
+
+    if(s < tpg->_slots.size() && tpg->_slots[s]->_is_running) {
+      break;
+    }
+    
+    // run_until has checked the predicate for the first iteration
+    if(tpg->_num_iterations > 0 && (tpg->_is_cancelled || tpg->_pred())) {
+      tpg->_is_stopped = true;
+      break;
+    }
+
+    if(s == tpg->_slots.size()) {
+      _add_slot(tpg);
+    }
+
+    auto slot = tpg->_slots[s].get();
+
+    ++tpg->_num_iterations;
+    tpg->_join_counter.fetch_add(1, std::memory_order_relaxed);
+    
+    slot->_is_running = true;
+    _set_up_topology(slot);
+  }
+}
+
+// Function: _tear_down_iteration
+// finishes an iteration of a run with overlapping iterations and starts the
+// next ones; returns true if the run has no more running iterations
+inline bool Executor::_tear_down_iteration(Topology* slot) {
+  
+  auto tpg = slot->_run;
+
+  std::lock_guard<std::mutex> lock(tpg->_taskflow._mutex);
+
+  slot->_is_running = false;
+  tpg->_join_counter.fetch_sub(1, std::memory_order_relaxed);
+
+  _start_iterations(tpg);
+
+  return tpg->_join_counter.load(std::memory_order_relaxed) == 0;
+}
+
+// Procedure: _tear_down_iterations
+// unwires the tokens of ordered iterations and returns the copies of the 
+// graph to the pool after the last iteration of a run
+inline void Executor::_tear_down_iterations(Topology* tpg) {
+
+  // ---- under taskflow lock ----
+
+  if(!tpg->_tokens.empty()) {
+    for(auto& slot : tpg->_slots) {
+      for(auto node : slot->_graph()._nodes) {
+        if(node->_state.load(std::memory_order_relaxed) & Node::DETACHED) {
+          continue;
+        }
+        auto& semaphores = node->_semaphores;
+        semaphores->to_acquire.pop_back();
+        semaphores->to_release.pop_back();
+        if(semaphores->to_acquire.empty() && semaphores->to_release.empty()) {
+          semaphores.reset();
+        }
+      }
+    }
+  }
+
+  for(auto& slot : tpg->_slots) {
+    if(slot->_clone) {
+      tpg->_taskflow._clones.push_back(std::move(slot->_clone));
+    }
+  }
+
+  tpg->_slots.clear();
+  tpg->_tokens.clear();
+}
+
+// Procedure: _set_up_levels
+// computes the largest path weight from each node to a sink in reverse
+// topological order, using the join counters to count unvisited successors;
+// condition tasks only count themselves as their successors may loop back
+inline void Executor::_set_up_levels(Graph& g) {
+
+  std::vector<Node*> sinks;
+
+  for(auto node : g._nodes) {
+    size_t n = (node->_handle.index() == Node::CONDITION) ? 
+               0 : node->num_successors();
+    node->_level = 0;
+    node->_join_counter.store(n, std::memory_order_relaxed);
+    if(n == 0) {
+      sinks.push_back(node);
+    }
+  }
+
+  while(!sinks.empty()) {
+    
+    Node* node = sinks.back();
+    sinks.pop_back();
+    
+    node->_level += node->_weight;
+
+    for(auto p : node->_dependents) {
+      if(p->_handle.index() == Node::CONDITION) {
+        continue;
+      }
+      p->_level = std::max(p->_level, node->_level);
+      // no other thread accesses the graph yet
+      auto n = p->_join_counter.load(std::memory_order_relaxed) - 1;
+      p->_join_counter.store(n, std::memory_order_relaxed);
+      if(n == 0) {
+        sinks.push_back(p);
+      }
+    }
+  }
+}
+
 // Function: _tear_down_topology
 inline void Executor::_tear_down_topology(Topology* tpg) {
 
+  // the last iteration of a run with overlapping iterations tears down
+  // the run
+  if(tpg->_run) {
+    if(!_tear_down_iteration(tpg)) {
+      return;
+    }
+    tpg = tpg->_run;
+  }
+
   auto &f = tpg->_taskflow;
 
   //assert(&tpg == &(f._topologies.front()));
 
   // case 1: we still need to run the topology again
-  if(!tpg->_is_cancelled && !tpg->_pred()) {
+  if(tpg->_slots.empty() && !tpg->_is_cancelled && !tpg->_pred()) {
     //assert(tpg->_join_counter == 0);
     std::lock_guard<std::mutex> lock(f._mutex);
     tpg->_join_counter = tpg->_sources.size();
@@ -1226,13 +2367,43 @@ inline void Executor::_tear_down_topology(Topology* tpg) {
   else {
 
     // TODO: if the topology is cancelled, need to release all constraints
+
+    _observe_topology_end(tpg);
     
     if(tpg->_call != nullptr) {
       tpg->_call();
     }
 
+    if(!tpg->_slots.empty()) {
+      std::lock_guard<std::mutex> lock(f._mutex);
+      _tear_down_iterations(tpg);
+    }
+
+    // A concurrent run returns its copy of the graph to the pool before 
+    // setting the promise, since the taskflow might be destroyed soon after.
+    if(tpg->_clone) {
+
+      std::shared_ptr<Topology> t;
+      {
+        std::lock_guard<std::mutex> lock(f._mutex);
+        auto itr = std::find_if(
+          f._concurrent_topologies.begin(), f._concurrent_topologies.end(),
+          [tpg] (const std::shared_ptr<Topology>& p) { return p.get() == tpg; }
+        );
+        t = std::move(*itr);
+        f._concurrent_topologies.erase(itr);
+        f._clones.push_back(std::move(t->_clone));
+      }
+
+      auto p {std::move(t->_promise)};
+      t.reset();
+
+      p.set_value();
+
+      _decrement_topology_and_notify();
+    }
     // If there is another run (interleave between lock)
-    if(std::unique_lock<std::mutex> lock(f._mutex); f._topologies.size()>1) {
+    else if(std::unique_lock<std::mutex> lock(f._mutex); f._topologies.size()>1) {
       //assert(tpg->_join_counter == 0);
 
       // Set the promise
@@ -1368,6 +2539,199 @@ void Subflow::silent_async(F&& f, ArgsT&&... args) {
   _executor._schedule(node);
 }
 
+// ############################################################################
+// Forward Declaration: Runtime
+// ############################################################################
+
+// Procedure: corun_n
+template <typename C>
+void Runtime::corun_n(size_t N, C&& callable) {
+
+  using T = std::remove_reference_t<C>;
+
+  if(N == 0) {
+    return;
+  }
+
+  if(N == 1) {
+    callable(size_t{0});
+    return;
+  }
+
+  auto& h = std::get<Node::Runtime>(_parent->_handle);
+
+  h.callable = const_cast<void*>(static_cast<const void*>(&callable));
+  h.invoke = [] (void* c, size_t i) { (*static_cast<T*>(c))(i); };
+
+  // helpers are static tasks joining this task like subflow tasks do
+  while(h.helpers.size() < N - 1) {
+    auto p = _parent;
+    auto i = h.helpers.size() + 1;
+    h.helpers.push_back(node_pool.animate(
+      std::in_place_type_t<Node::Static>{}, [p, i] () {
+        auto& h = std::get<Node::Runtime>(p->_handle);
+        h.invoke(h.callable, i);
+      }
+    ));
+  }
+
+  _parent->_join_counter.fetch_add(N - 1);
+
+  for(size_t i=0; i<N-1; i++) {
+    h.helpers[i]->_topology = _parent->_topology;
+    h.helpers[i]->_parent = _parent;
+    _executor._schedule(h.helpers[i]);
+  }
+
+  callable(size_t{0});
+
+  _executor._corun_until(_worker, [this] () { 
+    return _parent->_join_counter == 0; 
+  });
+}
+
+// Procedure: corun_loop
+// runs a loop on N workers of the runtime, each on its own copy of the loop,
+// so the state a loop advances across its iterations, such as an iterator 
+// or a stateful callable, is never shared between workers
+template <typename L>
+void corun_loop(Runtime& rt, size_t N, const L& loop) {
+  rt.corun_n(N, [&loop] (size_t) {
+    auto l = loop;
+    l();
+  });
+}
+
+
+// ############################################################################
+// Forward Declaration: TFProfObserver
+// ############################################################################
+
+// Function: weigh
+inline size_t TFProfObserver::weigh(Taskflow& taskflow) const {
+
+  // total duration and count of the observed tasks of each name
+  std::unordered_map<std::string, std::pair<size_t, size_t>> durations;
+
+  for(const auto& worker : _timeline.segments) {
+    for(const auto& level : worker) {
+      for(const auto& segment : level) {
+        auto& d = durations[segment.name];
+        d.first += std::chrono::duration_cast<std::chrono::microseconds>(
+          segment.end - segment.beg
+        ).count();
+        d.second++;
+      }
+    }
+  }
+
+  size_t num_weighted = 0;
+
+  taskflow.for_each_task([&] (Task task) {
+    if(task.name().empty()) {
+      return;
+    }
+    if(auto itr = durations.find(task.name()); itr != durations.end()) {
+      task.weight(std::max(size_t{1}, itr->second.first / itr->second.second));
+      ++num_weighted;
+    }
+  });
+
+  return num_weighted;
+}
+
+// ############################################################################
+// Forward Declaration: TFProfManager
+// ############################################################################
+
+// Procedure: _unregister
+inline void TFProfManager::_unregister(Executor* executor) {
+  std::lock_guard lock(_mutex);
+  auto itr = std::find_if(_executors.begin(), _executors.end(), 
+    [executor] (const auto& e) { return e.first == executor; }
+  );
+  if(itr != _executors.end()) {
+    if(itr->second) {
+      executor->remove_observer(std::move(itr->second));
+    }
+    _executors.erase(itr);
+  }
+}
+
+// Function: control
+inline bool TFProfManager::control(const std::string& command) {
+
+  std::istringstream iss(command);
+  std::string op;
+
+  if(!(iss >> op)) {
+    return false;
+  }
+
+  std::lock_guard lock(_mutex);
+
+  if(op == "start") {
+    for(auto& [executor, observer] : _executors) {
+      if(!observer) {
+        observer = executor->make_observer<TFProfObserver>();
+      }
+    }
+  }
+  else if(op == "stop") {
+    for(auto& [executor, observer] : _executors) {
+      if(observer) {
+        executor->remove_observer(std::move(observer));
+        observer = nullptr;
+      }
+    }
+  }
+  else if(op == "clear") {
+    for(auto& [executor, observer] : _executors) {
+      if(observer) {
+        observer->clear();
+      }
+    }
+  }
+  else if(op == "snapshot") {
+
+    std::string path;
+    if(!(iss >> path)) {
+      return false;
+    }
+
+    // a period beyond the range of nanoseconds covers the whole profile
+    auto period = std::chrono::nanoseconds::max();
+    if(std::string token; iss >> token) {
+      char* end = nullptr;
+      auto seconds = std::strtod(token.c_str(), &end);
+      if(*end != '\0' || !std::isfinite(seconds) || seconds <= 0) {
+        return false;
+      }
+      if(std::chrono::duration<double>(seconds) < period) {
+        period = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::duration<double>(seconds)
+        );
+      }
+    }
+
+    if(std::string extra; iss >> extra) {
+      return false;
+    }
+
+    ProfileData data;
+    for(auto& [executor, observer] : _executors) {
+      if(observer) {
+        data.timelines.push_back(observer->_copy(observer->_since(period)));
+      }
+    }
+    return TFProfObserver::_write(path, data);
+  }
+  else {
+    return false;
+  }
+
+  return true;
+}
 
 }  // end of namespace tf -----------------------------------------------------
 
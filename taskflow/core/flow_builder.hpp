@@ -69,6 +69,33 @@ class FlowBuilder {
     >
     Task emplace(C&& callable);
     
+    /**
+    @brief creates a runtime task
+    
+    @tparam C callable type constructible from std::function<void(tf::Runtime&)>
+
+    @param callable callable to construct a runtime task
+
+    @return a tf::Task handle
+    
+    The following example creates a runtime task that runs a loop body
+    on four workers, including the worker running the task.
+
+    @code{.cpp}
+    tf::Task runtime_task = taskflow.emplace([](tf::Runtime& rt){
+      rt.corun_n(4, [](size_t w){
+        std::cout << "worker " << w << '\n';
+      });
+    });
+    @endcode
+    
+    Please refer to tf::Runtime for details.
+    */
+    template <typename C, 
+      std::enable_if_t<is_runtime_task_v<C>, void>* = nullptr
+    >
+    Task emplace(C&& callable);
+    
     /**
     @brief creates a condition task
     
@@ -379,6 +406,144 @@ class FlowBuilder {
     template <typename B, typename E, typename S, typename C>
     Task for_each_index(B&& first, E&& last, S&& step, C callable);
     
+    /**
+    @brief constructs a two-dimensional index-based parallel-for task 
+
+    @tparam B0 beginning row index type (must be integral)
+    @tparam E0 ending row index type (must be integral)
+    @tparam B1 beginning column index type (must be integral)
+    @tparam E1 ending column index type (must be integral)
+    @tparam C callable type
+
+    @param first0 row index of the beginning (inclusive)
+    @param last0 row index of the end (exclusive)
+    @param first1 column index of the beginning (inclusive)
+    @param last1 column index of the end (exclusive)
+    @param tile0 number of rows per tile
+    @param tile1 number of columns per tile
+    @param callable a callable object to apply to each pair of indices
+
+    @return a tf::Task handle
+    
+    The task spawns a subflow that applies the callable object to each 
+    index pair in <tt>[first0, last0) x [first1, last1)</tt>.
+    The iteration space is partitioned into tiles of 
+    <tt>tile0 x tile1</tt> indices, which workers claim in Morton order 
+    using guided scheduling, so that the tiles a worker claims in a row 
+    stay close to each other.
+    Within a tile, indices are visited in row-major order.
+    
+    This method is equivalent to the parallel execution of the following loop:
+    
+    @code{.cpp}
+    for(auto i=first0; i<last0; i++) {
+      for(auto j=first1; j<last1; j++) {
+        callable(i, j);
+      }
+    }
+    @endcode
+
+    Arguments are templated to enable stateful passing using std::reference_wrapper.
+    The callable needs to take two arguments of the integral index types.
+    
+    Please refer to @ref ParallelIterations for details.
+    */
+    template <
+      typename B0, typename E0, typename B1, typename E1, typename C
+    >
+    Task for_each_index_2d(
+      B0&& first0, E0&& last0, B1&& first1, E1&& last1, 
+      size_t tile0, size_t tile1, C callable
+    );
+    
+    /**
+    @brief constructs a two-dimensional index-based parallel-for task
+           using tiles of 64 x 64 indices
+
+    Please refer to 
+    tf::FlowBuilder::for_each_index_2d(B0&&, E0&&, B1&&, E1&&, size_t, size_t, C) 
+    for details.
+    */
+    template <
+      typename B0, typename E0, typename B1, typename E1, typename C
+    >
+    Task for_each_index_2d(
+      B0&& first0, E0&& last0, B1&& first1, E1&& last1, C callable
+    );
+    
+    /**
+    @brief constructs a three-dimensional index-based parallel-for task 
+
+    @tparam B0 beginning index type of the first dimension (must be integral)
+    @tparam E0 ending index type of the first dimension (must be integral)
+    @tparam B1 beginning index type of the second dimension (must be integral)
+    @tparam E1 ending index type of the second dimension (must be integral)
+    @tparam B2 beginning index type of the third dimension (must be integral)
+    @tparam E2 ending index type of the third dimension (must be integral)
+    @tparam C callable type
+
+    @param first0 index of the beginning of the first dimension (inclusive)
+    @param last0 index of the end of the first dimension (exclusive)
+    @param first1 index of the beginning of the second dimension (inclusive)
+    @param last1 index of the end of the second dimension (exclusive)
+    @param first2 index of the beginning of the third dimension (inclusive)
+    @param last2 index of the end of the third dimension (exclusive)
+    @param tile0 number of indices per tile in the first dimension
+    @param tile1 number of indices per tile in the second dimension
+    @param tile2 number of indices per tile in the third dimension
+    @param callable a callable object to apply to each triple of indices
+
+    @return a tf::Task handle
+    
+    The task spawns a subflow that applies the callable object to each 
+    index triple in <tt>[first0, last0) x [first1, last1) x [first2, last2)</tt>.
+    Like tf::FlowBuilder::for_each_index_2d, the iteration space is 
+    partitioned into tiles that workers claim in Morton order using guided
+    scheduling.
+    
+    This method is equivalent to the parallel execution of the following loop:
+    
+    @code{.cpp}
+    for(auto i=first0; i<last0; i++) {
+      for(auto j=first1; j<last1; j++) {
+        for(auto k=first2; k<last2; k++) {
+          callable(i, j, k);
+        }
+      }
+    }
+    @endcode
+
+    Arguments are templated to enable stateful passing using std::reference_wrapper.
+    The callable needs to take three arguments of the integral index types.
+    
+    Please refer to @ref ParallelIterations for details.
+    */
+    template <
+      typename B0, typename E0, typename B1, typename E1, 
+      typename B2, typename E2, typename C
+    >
+    Task for_each_index_3d(
+      B0&& first0, E0&& last0, B1&& first1, E1&& last1, B2&& first2, E2&& last2,
+      size_t tile0, size_t tile1, size_t tile2, C callable
+    );
+    
+    /**
+    @brief constructs a three-dimensional index-based parallel-for task 
+           using tiles of 16 x 16 x 16 indices
+
+    Please refer to 
+    tf::FlowBuilder::for_each_index_3d(B0&&, E0&&, B1&&, E1&&, B2&&, E2&&, size_t, size_t, size_t, C) 
+    for details.
+    */
+    template <
+      typename B0, typename E0, typename B1, typename E1, 
+      typename B2, typename E2, typename C
+    >
+    Task for_each_index_3d(
+      B0&& first0, E0&& last0, B1&& first1, E1&& last1, B2&& first2, E2&& last2,
+      C callable
+    );
+    
     // ------------------------------------------------------------------------
     // reduction
     // ------------------------------------------------------------------------
@@ -454,6 +619,111 @@ class FlowBuilder {
     template <typename B, typename E, typename T, typename BOP, typename UOP>
     Task transform_reduce(B&& first, E&& last, T& init, BOP bop, UOP uop);
     
+    // ------------------------------------------------------------------------
+    // histogram and reduction by key
+    // ------------------------------------------------------------------------
+    
+    /**
+    @brief constructs a parallel histogram task
+  
+    @tparam B beginning iterator type
+    @tparam E ending iterator type
+    @tparam H bins type
+    @tparam F binning function type
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param bins random-accessible container of counters
+    @param binning_fn unary function that returns the bin index of an element
+
+    @return a tf::Task handle
+    
+    The task spawns a subflow to count the elements in the range 
+    <tt>[first, last)</tt> into @c bins. 
+    Elements whose bin index is not less than <tt>std::size(bins)</tt>
+    are ignored.
+    Counts are added to the existing values of @c bins.
+    
+    This method is equivalent to the parallel execution of the following loop:
+    
+    @code{.cpp}
+    for(auto itr=first; itr!=last; itr++) {
+      if(size_t k = binning_fn(*itr); k < std::size(bins)) {
+        ++bins[k];
+      }
+    }
+    @endcode
+
+    Each worker counts a contiguous block of the range into private bins,
+    which are then summed into @c bins in parallel, so no counter is 
+    shared between workers.
+    
+    Arguments are templated to enable stateful passing using std::reference_wrapper. 
+   
+    Please refer to @ref ParallelReduction for details. 
+    */
+    template <typename B, typename E, typename H, typename F>
+    Task histogram(B&& first, E&& last, H& bins, F binning_fn);
+    
+    /**
+    @brief constructs a parallel task to reduce the values of consecutive
+           equal keys
+  
+    @tparam B beginning key iterator type (random-accessible)
+    @tparam E ending key iterator type (random-accessible)
+    @tparam V beginning value iterator type (random-accessible)
+    @tparam KO beginning key output iterator type (random-accessible)
+    @tparam VO beginning value output iterator type (random-accessible)
+    @tparam O binary reducer type
+    @tparam R result type
+
+    @param keys_first iterator to the beginning of the keys (inclusive)
+    @param keys_last iterator to the end of the keys (exclusive)
+    @param values_first iterator to the beginning of the values
+    @param keys_output iterator to the beginning of the key output
+    @param values_output iterator to the beginning of the value output
+    @param bop associative binary operator to reduce the values
+    @param result pair of iterators to store the ends of the key and 
+                  the value outputs
+
+    @return a tf::Task handle
+    
+    For every run of consecutive keys in <tt>[keys_first, keys_last)</tt> 
+    that compare equal using the operator @c ==, the task writes the key
+    to the key output and the reduction of the corresponding values using 
+    @c bop to the value output.
+    Reductions use the value type of the value output.
+    
+    @code{.cpp}
+    std::vector<int> keys   = {1, 1, 2, 3, 3, 3};
+    std::vector<int> values = {1, 2, 3, 4, 5, 6};
+    std::vector<int> ukeys(keys.size()), sums(keys.size());
+    std::pair<std::vector<int>::iterator, std::vector<int>::iterator> ends;
+
+    taskflow.reduce_by_key(
+      keys.begin(), keys.end(), values.begin(), ukeys.begin(), sums.begin(),
+      std::plus<int>{}, ends
+    );
+    // after execution, ukeys = {1, 2, 3} and sums = {3, 3, 15}
+    @endcode
+
+    Runs that span multiple workers are reduced piecewise and combined 
+    at the end, so the values are reduced in their original order but 
+    not in a single pass.
+    
+    Arguments are templated to enable stateful passing using std::reference_wrapper. 
+   
+    Please refer to @ref ParallelReduction for details. 
+    */
+    template <
+      typename B, typename E, typename V, typename KO, typename VO, 
+      typename O, typename R
+    >
+    Task reduce_by_key(
+      B&& keys_first, E&& keys_last, V&& values_first, 
+      KO&& keys_output, VO&& values_output, O bop, R& result
+    );
+    
     // ------------------------------------------------------------------------
     // sort
     // ------------------------------------------------------------------------
@@ -500,6 +770,340 @@ class FlowBuilder {
     template <typename B, typename E>
     Task sort(B&& first, E&& last);
     
+    /**
+    @brief constructs a dynamic task to sort a range of keys in parallel
+           and permute a range of values alongside
+  
+    @tparam B beginning key iterator type (random-accessible)
+    @tparam E ending key iterator type (random-accessible)
+    @tparam V beginning value iterator type (random-accessible)
+    @tparam C comparator type
+
+    @param keys_first iterator to the beginning of the keys (inclusive)
+    @param keys_last iterator to the end of the keys (exclusive)
+    @param values_first iterator to the beginning of the values
+    @param cmp comparison function object applied to the keys
+    
+    The task spawns a subflow to parallelly sort the keys in the range 
+    <tt>[keys_first, keys_last)</tt> and applies the same permutation to the 
+    values in the range starting at @c values_first.
+    Keys and values are moved in place through a proxy iterator and are never 
+    packed into an intermediate array of pairs.
+    
+    @code{.cpp}
+    std::vector<int>  keys   = {3, 1, 2};
+    std::vector<char> values = {'c', 'a', 'b'};
+    taskflow.sort_by_key(keys.begin(), keys.end(), values.begin());
+    // after execution, keys = {1, 2, 3} and values = {'a', 'b', 'c'}
+    @endcode
+    
+    Arguments are templated to enable stateful passing using std::reference_wrapper. 
+
+    Please refer to @ref ParallelSort for details.
+    */
+    template <typename B, typename E, typename V, typename C>
+    Task sort_by_key(B&& keys_first, E&& keys_last, V&& values_first, C cmp);
+    
+    /**
+    @brief constructs a dynamic task to sort a range of keys in parallel
+           and permute a range of values alongside using the @c std::less<T> 
+           comparator, where @c T is the key type
+  
+    @tparam B beginning key iterator type (random-accessible)
+    @tparam E ending key iterator type (random-accessible)
+    @tparam V beginning value iterator type (random-accessible)
+
+    @param keys_first iterator to the beginning of the keys (inclusive)
+    @param keys_last iterator to the end of the keys (exclusive)
+    @param values_first iterator to the beginning of the values
+    
+    Arguments are templated to enable stateful passing using std::reference_wrapper. 
+
+    Please refer to @ref ParallelSort for details.
+    */
+    template <typename B, typename E, typename V>
+    Task sort_by_key(B&& keys_first, E&& keys_last, V&& values_first);
+    
+    /**
+    @brief constructs a dynamic task to compute the permutation that sorts
+           a range of items in parallel
+  
+    @tparam B beginning iterator type (random-accessible)
+    @tparam E ending iterator type (random-accessible)
+    @tparam P beginning index iterator type (random-accessible)
+    @tparam C comparator type
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param indices_first iterator to the beginning of the output indices
+    @param cmp comparison function object
+    
+    The task writes the indices <tt>0, 1, ..., N-1</tt> to the range
+    starting at @c indices_first and spawns a subflow to parallelly sort them
+    such that <tt>first[indices_first[i]]</tt> is in increasing order.
+    The range <tt>[first, last)</tt> is left unchanged.
+    
+    @code{.cpp}
+    std::vector<float>  data = {0.3f, 0.1f, 0.2f};
+    std::vector<size_t> perm(data.size());
+    taskflow.argsort(data.begin(), data.end(), perm.begin());
+    // after execution, perm = {1, 2, 0}
+    @endcode
+    
+    Arguments are templated to enable stateful passing using std::reference_wrapper. 
+
+    Please refer to @ref ParallelSort for details.
+    */
+    template <typename B, typename E, typename P, typename C>
+    Task argsort(B&& first, E&& last, P&& indices_first, C cmp);
+    
+    /**
+    @brief constructs a dynamic task to compute the permutation that sorts
+           a range of items in parallel using the @c std::less<T> comparator, 
+           where @c T is the element type
+  
+    @tparam B beginning iterator type (random-accessible)
+    @tparam E ending iterator type (random-accessible)
+    @tparam P beginning index iterator type (random-accessible)
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param indices_first iterator to the beginning of the output indices
+    
+    Arguments are templated to enable stateful passing using std::reference_wrapper. 
+
+    Please refer to @ref ParallelSort for details.
+    */
+    template <typename B, typename E, typename P>
+    Task argsort(B&& first, E&& last, P&& indices_first);
+    
+    // ------------------------------------------------------------------------
+    // compaction
+    // ------------------------------------------------------------------------
+    
+    /**
+    @brief constructs a dynamic task to copy the elements that satisfy 
+           a predicate in parallel
+
+    @tparam B beginning iterator type (random-accessible)
+    @tparam E ending iterator type (random-accessible)
+    @tparam D beginning output iterator type (random-accessible)
+    @tparam P unary predicate type
+    @tparam R result iterator type
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param d_first iterator to the beginning of the output range
+    @param pred unary predicate which returns @c true for the elements to copy
+    @param result iterator to store the end of the output range
+    
+    The task spawns a subflow to copy the elements in the range 
+    <tt>[first, last)</tt> for which @c pred returns @c true to the range 
+    starting at @c d_first, preserving their relative order.
+    It is equivalent to the following parallel execution:
+
+    @code{.cpp}
+    result = std::copy_if(first, last, d_first, pred);
+    @endcode
+    
+    The predicate is applied exactly once to each element.
+    The output range must not overlap the input range.
+
+    Arguments are templated to enable stateful passing using std::reference_wrapper. 
+
+    Please refer to @ref ParallelCompaction for details.
+    */
+    template <typename B, typename E, typename D, typename P, typename R>
+    Task copy_if(B&& first, E&& last, D&& d_first, P pred, R& result);
+    
+    /**
+    @brief constructs a dynamic task to remove the elements that satisfy 
+           a predicate in parallel
+
+    @tparam B beginning iterator type (random-accessible)
+    @tparam E ending iterator type (random-accessible)
+    @tparam P unary predicate type
+    @tparam R result iterator type
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param pred unary predicate which returns @c true for the elements to remove
+    @param result iterator to store the new end of the range
+    
+    The task spawns a subflow to move the elements in the range 
+    <tt>[first, last)</tt> for which @c pred returns @c false to the front
+    of the range, preserving their relative order.
+    It is equivalent to the following parallel execution:
+
+    @code{.cpp}
+    result = std::remove_if(first, last, pred);
+    @endcode
+    
+    The predicate is applied exactly once to each element.
+
+    Arguments are templated to enable stateful passing using std::reference_wrapper. 
+
+    Please refer to @ref ParallelCompaction for details.
+    */
+    template <typename B, typename E, typename P, typename R>
+    Task remove_if(B&& first, E&& last, P pred, R& result);
+    
+    /**
+    @brief constructs a dynamic task to remove consecutive equivalent
+           elements in parallel
+
+    @tparam B beginning iterator type (random-accessible)
+    @tparam E ending iterator type (random-accessible)
+    @tparam P binary predicate type
+    @tparam R result iterator type
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param pred binary predicate which returns @c true if two elements are
+                equivalent
+    @param result iterator to store the new end of the range
+    
+    The task spawns a subflow to keep only the first element of every 
+    group of consecutive equivalent elements in the range 
+    <tt>[first, last)</tt>.
+    It is equivalent to the following parallel execution:
+
+    @code{.cpp}
+    result = std::unique(first, last, pred);
+    @endcode
+    
+    The predicate must be an equivalence relation.
+
+    Arguments are templated to enable stateful passing using std::reference_wrapper. 
+
+    Please refer to @ref ParallelCompaction for details.
+    */
+    template <typename B, typename E, typename P, typename R>
+    Task unique(B&& first, E&& last, P pred, R& result);
+    
+    /**
+    @brief constructs a dynamic task to remove consecutive equal elements 
+           in parallel using the @c std::equal_to<T> predicate, where @c T
+           is the element type
+
+    @tparam B beginning iterator type (random-accessible)
+    @tparam E ending iterator type (random-accessible)
+    @tparam R result iterator type
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param result iterator to store the new end of the range
+    
+    Arguments are templated to enable stateful passing using std::reference_wrapper. 
+
+    Please refer to @ref ParallelCompaction for details.
+    */
+    template <typename B, typename E, typename R>
+    Task unique(B&& first, E&& last, R& result);
+    
+    /**
+    @brief constructs a dynamic task to partition a range of elements 
+           in parallel
+
+    @tparam B beginning iterator type (random-accessible)
+    @tparam E ending iterator type (random-accessible)
+    @tparam P unary predicate type
+    @tparam R result iterator type
+
+    @param first iterator to the beginning (inclusive)
+    @param last iterator to the end (exclusive)
+    @param pred unary predicate which returns @c true for the elements to 
+                be placed first
+    @param result iterator to store the beginning of the second group
+    
+    The task spawns a subflow to reorder the elements in the range 
+    <tt>[first, last)</tt> such that all elements for which @c pred 
+    returns @c true precede the elements for which it returns @c false.
+    The relative order within each group is preserved.
+    It is equivalent to the following parallel execution:
+
+    @code{.cpp}
+    result = std::stable_partition(first, last, pred);
+    @endcode
+    
+    The predicate is applied exactly once to each element.
+
+    Arguments are templated to enable stateful passing using std::reference_wrapper. 
+
+    Please refer to @ref ParallelCompaction for details.
+    */
+    template <typename B, typename E, typename P, typename R>
+    Task partition(B&& first, E&& last, P pred, R& result);
+    
+    // ------------------------------------------------------------------------
+    // pipeline
+    // ------------------------------------------------------------------------
+    
+    /**
+    @brief constructs a dynamic task to run a pipeline
+
+    @tparam Ps pipe types
+
+    @param pipeline a tf::Pipeline object
+
+    @return a tf::Task handle
+    
+    The task spawns a subflow to schedule tokens through the pipes of 
+    the given pipeline until the first pipe stops the pipeline.
+    The task finishes when all tokens in the pipeline have left the last pipe.
+    The pipeline is captured by reference and must be alive during
+    the execution of the task.
+
+    Please refer to @ref ParallelPipeline for details.
+    */
+    template <typename... Ps>
+    Task pipeline(Pipeline<Ps...>& pipeline);
+    
+    // ------------------------------------------------------------------------
+    // wavefront
+    // ------------------------------------------------------------------------
+    
+    /**
+    @brief constructs a dynamic task to run a two-dimensional wavefront
+
+    @tparam M row count type (must be integral)
+    @tparam N column count type (must be integral)
+    @tparam C callable type
+
+    @param rows number of rows of blocks
+    @param cols number of columns of blocks
+    @param callable a callable object to apply to each block
+
+    @return a tf::Task handle
+    
+    The task spawns a subflow that applies the callable object to each 
+    block <tt>(i, j)</tt> of a <tt>rows x cols</tt> grid, where a block
+    runs only after the block above it, <tt>(i-1, j)</tt>, and the block 
+    to the left of it, <tt>(i, j-1)</tt>, have finished.
+    Instead of creating one task per block, the subflow tracks the 
+    dependencies with one atomic counter per block and keeps running 
+    the blocks that become ready on the same worker, spawning a new task 
+    only when two blocks become ready at the same time.
+    
+    This method is equivalent to the parallel execution of the following loop:
+    
+    @code{.cpp}
+    for(auto i=0; i<rows; i++) {
+      for(auto j=0; j<cols; j++) {
+        callable(i, j);
+      }
+    }
+    @endcode
+
+    Arguments are templated to enable stateful passing using std::reference_wrapper.
+    The callable needs to take two arguments of the integral index type and
+    may be invoked concurrently from different workers.
+
+    Please refer to @ref ParallelWavefront for details.
+    */
+    template <typename M, typename N, typename C>
+    Task wavefront(M&& rows, N&& cols, C callable);
+    
   protected:
     
     /**
@@ -539,6 +1143,14 @@ Task FlowBuilder::emplace(C&& c) {
   ));
 }
 
+// Function: emplace
+template <typename C, std::enable_if_t<is_runtime_task_v<C>, void>*>
+Task FlowBuilder::emplace(C&& c) {
+  return Task(_graph.emplace_back(
+    std::in_place_type_t<Node::Runtime>{}, std::forward<C>(c)
+  ));
+}
+
 // Function: emplace
 template <typename C, std::enable_if_t<is_condition_task_v<C>, void>*>
 Task FlowBuilder::emplace(C&& c) {
@@ -749,6 +1361,91 @@ inline bool Subflow::joinable() const {
   return _joinable;
 }
 
+// ----------------------------------------------------------------------------
+// Runtime
+// ----------------------------------------------------------------------------
+
+/** 
+@class Runtime
+
+@brief class to give a runtime task direct access to its executor
+
+A runtime task is created from a callable that takes a tf::Runtime 
+reference.
+Unlike a dynamic task, a runtime task does not build a subflow graph 
+on every run.
+Instead, tf::Runtime::corun_n runs a callable in parallel on a set of 
+helper tasks that are allocated once per task and reused across runs, 
+which keeps the overhead of running small parallel loops low.
+
+@code{.cpp}
+std::vector<int> data(1000);
+
+tf::Task task = taskflow.emplace([&](tf::Runtime& rt){
+  size_t W = rt.executor().num_workers();
+  rt.corun_n(W, [&](size_t w){
+    for(size_t i=w; i<data.size(); i+=W) {
+      data[i] = i;
+    }
+  });
+});
+@endcode
+*/ 
+class Runtime {
+
+  friend class Executor;
+
+  public:
+    
+    /**
+    @brief queries the executor that runs this task
+    */
+    Executor& executor();
+
+    /**
+    @brief runs a callable on @c N workers and waits for all of them to finish
+    
+    @tparam C callable type
+
+    @param N number of parallel invocations
+    @param callable callable object taking the invocation index of type @c size_t
+
+    Invokes <tt>callable(0)</tt>, ..., <tt>callable(N-1)</tt> in parallel.
+    The calling worker runs <tt>callable(0)</tt> itself and the other 
+    invocations on helper tasks, which are allocated on the first call 
+    and reused by later calls.
+    While waiting for the helpers to finish, the calling worker executes 
+    other tasks instead of blocking.
+    All invocations share the same callable object, which is captured by 
+    reference and must stay alive until the call returns.
+
+    This method is not thread-safe and must be called only from the 
+    runtime task itself.
+    */
+    template <typename C>
+    void corun_n(size_t N, C&& callable);
+
+  private:
+    
+    Runtime(Executor&, Worker&, Node*);
+
+    Executor& _executor;
+    Worker& _worker;
+    Node* _parent;
+};
+
+// Constructor
+inline Runtime::Runtime(Executor& executor, Worker& worker, Node* parent) :
+  _executor {executor},
+  _worker   {worker},
+  _parent   {parent} {
+}
+
+// Function: executor
+inline Executor& Runtime::executor() {
+  return _executor;
+}
+
 }  // end of namespace tf. ---------------------------------------------------
 
 
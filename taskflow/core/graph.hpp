@@ -66,6 +66,9 @@ class Graph {
   private:
 
     std::vector<Node*> _nodes;
+
+    bool _clone(Graph&) const;
+    const Node* _find_unclonable() const;
 };
 
 // ----------------------------------------------------------------------------
@@ -80,6 +83,8 @@ class Node {
   friend class Executor;
   friend class FlowBuilder;
   friend class Subflow;
+  friend class tf::Runtime;
+  friend class TaskGroup;
   friend class Sanitizer;
 
   TF_ENABLE_POOLABLE_ON_THIS;
@@ -97,6 +102,9 @@ class Node {
     Static(C&&);
 
     std::function<void()> work;
+
+    // tasks fused into this task by tf::Taskflow::fuse, run after work
+    std::vector<Node*> fused;
   };
 
   // dynamic work handle
@@ -109,6 +117,28 @@ class Node {
     Graph subgraph;
   };
   
+  // runtime work handle
+  struct Runtime {
+
+    template <typename C> 
+    Runtime(C&&);
+
+    Runtime(const Runtime&) = delete;
+    Runtime& operator = (const Runtime&) = delete;
+
+    // recycles the helpers also when Task::work replaces this handle
+    ~Runtime();
+
+    std::function<void(tf::Runtime&)> work;
+
+    // helper nodes reused by every co-run of this task
+    std::vector<Node*> helpers;
+
+    // callable of the current co-run and its type-erased invoker
+    void* callable {nullptr};
+    void (*invoke)(void*, size_t) {nullptr};
+  };
+  
   // condition work handle
   struct Condition {
 
@@ -143,8 +173,13 @@ class Node {
     
     template <typename C>
     SilentAsync(C&&);
+    
+    template <typename C>
+    SilentAsync(C&&, BulkTopology*);
 
     std::function<void()> work;
+
+    BulkTopology* bulk {nullptr};
   };
   
   // cudaFlow work handle
@@ -173,6 +208,7 @@ class Node {
     std::monostate,  // placeholder
     Static,          // static tasking
     Dynamic,         // dynamic tasking
+    Runtime,         // runtime tasking
     Condition,       // conditional tasking
     Module,          // composable tasking
     Async,           // async tasking
@@ -192,6 +228,7 @@ class Node {
   constexpr static auto PLACEHOLDER  = get_index_v<std::monostate, handle_t>;
   constexpr static auto STATIC       = get_index_v<Static, handle_t>;
   constexpr static auto DYNAMIC      = get_index_v<Dynamic, handle_t>;
+  constexpr static auto RUNTIME      = get_index_v<Runtime, handle_t>;
   constexpr static auto CONDITION    = get_index_v<Condition, handle_t>; 
   constexpr static auto MODULE       = get_index_v<Module, handle_t>; 
   constexpr static auto ASYNC        = get_index_v<Async, handle_t>; 
@@ -217,6 +254,10 @@ class Node {
 
     void* _data {nullptr};
 
+    // estimated cost and longest weighted path to a sink, including itself
+    size_t _weight {1};
+    size_t _level {0};
+
     handle_t _handle;
 
     SmallVector<Node*> _successors;
@@ -230,6 +271,11 @@ class Node {
 
     std::atomic<int> _state {0};
     std::atomic<size_t> _join_counter {0};
+
+#ifdef TF_ENABLE_STATS
+    // time at which the node became ready, see tf::Executor::latency
+    std::chrono::steady_clock::time_point _ready_time;
+#endif
     
     void _precede(Node*);
     void _set_up_join_counter();
@@ -239,6 +285,8 @@ class Node {
     bool _acquire_all(std::vector<Node*>&);
 
     std::vector<Node*> _release_all();
+
+    Node* _clone() const;
 };
 
 // ----------------------------------------------------------------------------
@@ -264,6 +312,22 @@ template <typename C>
 Node::Dynamic::Dynamic(C&& c) : work {std::forward<C>(c)} {
 }
 
+// ----------------------------------------------------------------------------
+// Definition for Node::Runtime
+// ----------------------------------------------------------------------------
+    
+// Constructor
+template <typename C> 
+Node::Runtime::Runtime(C&& c) : work {std::forward<C>(c)} {
+}
+
+// Destructor
+inline Node::Runtime::~Runtime() {
+  for(auto helper : helpers) {
+    node_pool.recycle(helper);
+  }
+}
+
 // ----------------------------------------------------------------------------
 // Definition for Node::Condition
 // ----------------------------------------------------------------------------
@@ -323,6 +387,12 @@ Node::SilentAsync::SilentAsync(C&& c) :
   work {std::forward<C>(c)} {
 }
 
+// Constructor
+template <typename C>
+Node::SilentAsync::SilentAsync(C&& c, BulkTopology* b) :
+  work {std::forward<C>(c)}, bulk {b} {
+}
+
 // ----------------------------------------------------------------------------
 // Definition for Node
 // ----------------------------------------------------------------------------
@@ -334,8 +404,14 @@ Node::Node(Args&&... args): _handle{std::forward<Args>(args)...} {
 
 // Destructor
 inline Node::~Node() {
-  // this is to avoid stack overflow
 
+  if(_handle.index() == STATIC) {
+    for(auto node : std::get<Static>(_handle).fused) {
+      node_pool.recycle(node);
+    }
+  }
+
+  // this is to avoid stack overflow
   if(_handle.index() == DYNAMIC) {
 
     auto& subgraph = std::get<Dynamic>(_handle).subgraph;
@@ -423,7 +499,10 @@ inline bool Node::_is_cancelled() const {
     }
   }
   // async tasks spawned from subflow does not have topology
-  return _topology && _topology->_is_cancelled;
+  return _topology && (
+    _topology->_is_cancelled || 
+    (_topology->_run && _topology->_run->_is_cancelled)
+  );
 }
 
 // Procedure: _set_up_join_counter
@@ -475,6 +554,69 @@ inline std::vector<Node*> Node::_release_all() {
   return nodes;
 }
 
+// Function: _clone
+// creates a node that invokes the callable of this node and has the name 
+// and attributes of this node but no dependencies; returns nullptr if the 
+// task cannot run more than once at a time
+inline Node* Node::_clone() const {
+
+  Node* node {nullptr};
+
+  switch(_handle.index()) {
+
+    case PLACEHOLDER:
+      node = node_pool.animate();
+    break;
+
+    case STATIC: {
+      auto& h = std::get<Static>(_handle);
+      node = node_pool.animate(
+        std::in_place_type_t<Static>{}, [&w=h.work] () { w(); }
+      );
+      for(auto f : h.fused) {
+        std::get<Static>(node->_handle).fused.push_back(f->_clone());
+      }
+    }
+    break;
+
+    case DYNAMIC:
+      node = node_pool.animate(
+        std::in_place_type_t<Dynamic>{}, 
+        [&w=std::get<Dynamic>(_handle).work] (Subflow& sf) { w(sf); }
+      );
+    break;
+
+    case RUNTIME:
+      node = node_pool.animate(
+        std::in_place_type_t<Runtime>{}, 
+        [&w=std::get<Runtime>(_handle).work] (tf::Runtime& rt) { w(rt); }
+      );
+    break;
+
+    case CONDITION:
+      node = node_pool.animate(
+        std::in_place_type_t<Condition>{}, 
+        [&w=std::get<Condition>(_handle).work] () { return w(); }
+      );
+    break;
+
+    // modules and GPU tasks own state that cannot be shared between runs
+    default:
+      return nullptr;
+  }
+
+  node->_name = _name;
+  node->_data = _data;
+  node->_weight = _weight;
+  node->_level = _level;
+
+  if(_semaphores) {
+    node->_semaphores = std::make_unique<Semaphores>(*_semaphores);
+  }
+
+  return node;
+}
+
 // ----------------------------------------------------------------------------
 // Graph definition
 // ----------------------------------------------------------------------------
@@ -513,9 +655,12 @@ inline void Graph::clear() {
 // Procedure: clear_detached
 inline void Graph::clear_detached() {
 
-  auto mid = std::partition(_nodes.begin(), _nodes.end(), [] (Node* node) {
-    return !(node->_state.load(std::memory_order_relaxed) & Node::DETACHED);
-  });
+  // keeps the order of nodes, in which copies of the graph are created
+  auto mid = std::stable_partition(
+    _nodes.begin(), _nodes.end(), [] (Node* node) {
+      return !(node->_state.load(std::memory_order_relaxed) & Node::DETACHED);
+    }
+  );
   
   for(auto itr = mid; itr != _nodes.end(); ++itr) {
     node_pool.recycle(*itr);
@@ -531,6 +676,54 @@ inline void Graph::merge(Graph&& g) {
   g._nodes.clear();
 }
 
+// Function: _clone
+// copies the tasks of this graph, except for those spawned by detached 
+// subflows, and their dependencies into g in the same order; returns false 
+// if a task cannot be copied
+inline bool Graph::_clone(Graph& g) const {
+
+  std::unordered_map<const Node*, Node*> clones;
+  clones.reserve(_nodes.size());
+
+  for(auto node : _nodes) {
+    if(node->_state.load(std::memory_order_relaxed) & Node::DETACHED) {
+      continue;
+    }
+    auto clone = node->_clone();
+    if(clone == nullptr) {
+      return false;
+    }
+    g._nodes.push_back(clone);
+    clones.emplace(node, clone);
+  }
+
+  for(auto node : _nodes) {
+    if(auto itr = clones.find(node); itr != clones.end()) {
+      for(auto s : node->_successors) {
+        itr->second->_precede(clones.at(s));
+      }
+    }
+  }
+
+  return true;
+}
+
+// Function: _find_unclonable
+// returns a task that cannot run more than once at a time, or nullptr
+inline const Node* Graph::_find_unclonable() const {
+  for(auto node : _nodes) {
+    switch(node->_handle.index()) {
+      case Node::MODULE:
+      case Node::CUDAFLOW:
+      case Node::SYCLFLOW:
+        return node;
+      default:
+      break;
+    }
+  }
+  return nullptr;
+}
+
 // Function: size
 inline size_t Graph::size() const {
   return _nodes.size();
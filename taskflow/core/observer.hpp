@@ -196,8 +196,121 @@ class ObserverInterface {
   @param task_view a constant wrapper object to the task
   */
   virtual void on_exit(WorkerView w, TaskView task_view) = 0;
+
+  /**
+  @brief method to call after a worker thread tried to steal a task
+  @param w an immutable view of this worker thread
+  @param victim id of the worker whose queue the worker tried, or the number
+                of workers if it tried the shared queue of the executor
+  @param success whether the worker stole a task
+  */
+  virtual void on_steal(WorkerView w, size_t victim, bool success);
+
+  /**
+  @brief method to call before a worker thread is parked for lack of tasks
+  @param w an immutable view of this worker thread
+  */
+  virtual void on_park(WorkerView w);
+  
+  /**
+  @brief method to call after a parked worker thread is woken up
+  @param w an immutable view of this worker thread
+  */
+  virtual void on_unpark(WorkerView w);
+
+  /**
+  @brief method to call when a task becomes ready and is scheduled to run
+  @param task_view a constant wrapper object to the task
+
+  The method is called by the thread that schedules the task, 
+  which may not be a worker of the executor.
+  */
+  virtual void on_ready(TaskView task_view);
+
+  /**
+  @brief method to call when the executor starts running a taskflow
+  @param taskflow the taskflow to run
+  */
+  virtual void on_topology_start(const Taskflow& taskflow);
+  
+  /**
+  @brief method to call when the executor finishes running a taskflow
+  @param taskflow the taskflow that has run
+  */
+  virtual void on_topology_end(const Taskflow& taskflow);
+
+  private:
+
+  // bit flags of the above events that the observer overrides
+  int _events {0};
 };
 
+// Procedure: on_steal
+inline void ObserverInterface::on_steal(WorkerView, size_t, bool) {
+}
+
+// Procedure: on_park
+inline void ObserverInterface::on_park(WorkerView) {
+}
+
+// Procedure: on_unpark
+inline void ObserverInterface::on_unpark(WorkerView) {
+}
+
+// Procedure: on_ready
+inline void ObserverInterface::on_ready(TaskView) {
+}
+
+// Procedure: on_topology_start
+inline void ObserverInterface::on_topology_start(const Taskflow&) {
+}
+
+// Procedure: on_topology_end
+inline void ObserverInterface::on_topology_end(const Taskflow&) {
+}
+
+/**
+@private
+*/
+// An executor dispatches an event other than entry and exit only to the 
+// observers whose classes override the corresponding method.
+enum ObserverEvent : int {
+  OBSERVE_STEAL    = 0x1,
+  OBSERVE_PARK     = 0x2,
+  OBSERVE_READY    = 0x4,
+  OBSERVE_TOPOLOGY = 0x8
+};
+
+/**
+@private
+*/
+template <typename O>
+constexpr int observer_events() {
+
+  using I = ObserverInterface;
+
+  int events = 0;
+  
+  if constexpr(!std::is_same_v<decltype(&O::on_steal), decltype(&I::on_steal)>) {
+    events |= OBSERVE_STEAL;
+  }
+  if constexpr(!std::is_same_v<decltype(&O::on_park), decltype(&I::on_park)> ||
+               !std::is_same_v<decltype(&O::on_unpark), decltype(&I::on_unpark)>) {
+    events |= OBSERVE_PARK;
+  }
+  if constexpr(!std::is_same_v<decltype(&O::on_ready), decltype(&I::on_ready)>) {
+    events |= OBSERVE_READY;
+  }
+  if constexpr(!std::is_same_v<decltype(&O::on_topology_start), 
+                               decltype(&I::on_topology_start)> ||
+               !std::is_same_v<decltype(&O::on_topology_end), 
+                               decltype(&I::on_topology_end)>) {
+    events |= OBSERVE_TOPOLOGY;
+  }
+
+  return events;
+}
+
 // ----------------------------------------------------------------------------
 // ChromeObserver definition
 // ----------------------------------------------------------------------------
@@ -438,6 +551,10 @@ executor.run(taskflow).wait();
 observer->dump(std::cout);
 @endcode
 
+The observer can be added to and removed from a running executor,
+and its data can be dumped, written with tf::TFProfObserver::snapshot,
+and cleared while the executor runs.
+
 We recommend using our @TFProf python script to observe thread activities 
 instead of the raw function call.
 The script will turn on environment variables needed for observing all executors 
@@ -472,15 +589,75 @@ class TFProfObserver : public ObserverInterface {
     */
     size_t num_tasks() const;
 
+    /**
+    @brief writes the tasks that finished within the given period
+           before now to a file
+
+    @param path file to write
+    @param period length of the period, or all tasks if omitted
+
+    Writes the binary @TFProf format if the path ends with @c .tfp,
+    or the JSON format otherwise, in the same way as the environment
+    variable @c TF_ENABLE_PROFILER.
+    Throws an exception if the file cannot be opened.
+
+    @code{.cpp}
+    // attaches an observer to a running executor during an incident
+    auto observer = executor.make_observer<tf::TFProfObserver>();
+    std::this_thread::sleep_for(std::chrono::seconds(30));
+    observer->snapshot("incident.tfp", std::chrono::seconds(10));
+    executor.remove_observer(std::move(observer));
+    @endcode
+    */
+    void snapshot(
+      const std::string& path, 
+      std::chrono::nanoseconds period = std::chrono::nanoseconds::max()
+    ) const;
+
+    /**
+    @brief assigns the observed durations to the tasks of a taskflow 
+           as their weights
+
+    @param taskflow the taskflow whose tasks are weighted
+
+    @return the number of weighted tasks
+
+    Sets the weight of every named task in the taskflow to the average 
+    duration in microseconds, but at least one, of the observed tasks of
+    the same name. 
+    With critical-path scheduling enabled, the executor prioritizes the
+    successors of a finished task with the largest weighted path to a sink
+    (see tf::Task::weight).
+
+    @code{.cpp}
+    taskflow.critical_path_scheduling(true);
+    auto observer = executor.make_observer<tf::TFProfObserver>();
+    executor.run(taskflow).wait();  // profiling run
+    observer->weigh(taskflow);
+    executor.run_n(taskflow, 100);  // follows the profiled critical path
+    @endcode
+    */
+    size_t weigh(Taskflow& taskflow) const;
+
   private:
     
     Timeline _timeline;
   
     std::vector<std::stack<observer_stamp_t>> _stacks;
+
+    // each worker locks its own mutex to append a segment, so that
+    // the timeline can be read and cleared while the executor runs
+    std::unique_ptr<std::mutex[]> _mutexes;
     
     inline void set_up(size_t num_workers) override final;
     inline void on_entry(WorkerView, TaskView) override final;
     inline void on_exit(WorkerView, TaskView) override final;
+
+    Timeline _copy(observer_stamp_t since) const;
+    observer_stamp_t _since(std::chrono::nanoseconds period) const;
+
+    static void _dump(std::ostream&, const Timeline&);
+    static bool _write(const std::string&, const ProfileData&);
 };  
 
 // Procedure: set_up
@@ -489,6 +666,7 @@ inline void TFProfObserver::set_up(size_t num_workers) {
   _timeline.origin = observer_stamp_t::clock::now();
   _timeline.segments.resize(num_workers);
   _stacks.resize(num_workers);
+  _mutexes.reset(new std::mutex[num_workers]);
 }
 
 // Procedure: on_entry
@@ -502,56 +680,137 @@ inline void TFProfObserver::on_exit(WorkerView wv, TaskView tv) {
   size_t w = wv.id();
 
   assert(!_stacks[w].empty());
-  
-  if(_stacks[w].size() > _timeline.segments[w].size()) {
-    _timeline.segments[w].resize(_stacks[w].size());
-  }
 
+  auto end = observer_stamp_t::clock::now();
   auto beg = _stacks[w].top();
   _stacks[w].pop();
 
+  std::lock_guard<std::mutex> lock(_mutexes[w]);
+  
+  if(_stacks[w].size() >= _timeline.segments[w].size()) {
+    _timeline.segments[w].resize(_stacks[w].size() + 1);
+  }
+
   _timeline.segments[w][_stacks[w].size()].emplace_back(
-    tv.name(), tv.type(), beg, observer_stamp_t::clock::now()
+    tv.name(), tv.type(), beg, end
   );
 }
 
 // Function: clear
+// The stacks belong to the workers and stay, so that the tasks running
+// during the call are still recorded when they finish.
 inline void TFProfObserver::clear() {
   for(size_t w=0; w<_timeline.segments.size(); ++w) {
+    std::lock_guard<std::mutex> lock(_mutexes[w]);
     for(size_t l=0; l<_timeline.segments[w].size(); ++l) {
       _timeline.segments[w][l].clear();
     }
-    while(!_stacks[w].empty()) {
-      _stacks[w].pop();
+  }
+}
+
+// Function: _copy
+inline Timeline TFProfObserver::_copy(observer_stamp_t since) const {
+
+  Timeline timeline;
+  timeline.uid = _timeline.uid;
+  timeline.origin = _timeline.origin;
+  timeline.segments.resize(_timeline.segments.size());
+
+  for(size_t w=0; w<_timeline.segments.size(); ++w) {
+    std::lock_guard<std::mutex> lock(_mutexes[w]);
+    for(const auto& level : _timeline.segments[w]) {
+      // segments of a level are appended in the order they end
+      auto first = std::partition_point(level.begin(), level.end(), 
+        [since] (const Segment& s) { return s.end < since; }
+      );
+      timeline.segments[w].emplace_back(first, level.end());
     }
   }
+
+  return timeline;
+}
+
+// Function: _since
+inline observer_stamp_t TFProfObserver::_since(std::chrono::nanoseconds period) const {
+  auto now = observer_stamp_t::clock::now();
+  if(period < now - _timeline.origin) {
+    return now - std::chrono::duration_cast<observer_stamp_t::duration>(period);
+  }
+  return _timeline.origin;
 }
 
 // Procedure: dump
 inline void TFProfObserver::dump(std::ostream& os) const {
+  _dump(os, _copy(_timeline.origin));
+}
+
+// Procedure: snapshot
+inline void TFProfObserver::snapshot(
+  const std::string& path, std::chrono::nanoseconds period
+) const {
+
+  ProfileData data;
+  data.timelines.push_back(_copy(_since(period)));
+
+  if(!_write(path, data)) {
+    TF_THROW("failed to open profile data ", path);
+  }
+}
+
+// Procedure: _write
+inline bool TFProfObserver::_write(
+  const std::string& path, const ProfileData& data
+) {
+
+  std::ofstream ofs(path);
+
+  if(!ofs) {
+    return false;
+  }
+
+  // .tfp
+  if(path.rfind(".tfp") != std::string::npos) {
+    Serializer<std::ofstream> serializer(ofs); 
+    serializer(data);
+  }
+  // .json
+  else {
+    ofs << "[\n";
+    for(size_t i=0; i<data.timelines.size(); ++i) {
+      if(i) ofs << ',';
+      _dump(ofs, data.timelines[i]);
+    }
+    ofs << "]\n";
+  }
+
+  return true;
+}
+
+// Procedure: _dump
+inline void TFProfObserver::_dump(std::ostream& os, const Timeline& timeline) {
 
   size_t first;
 
-  for(first = 0; first<_timeline.segments.size(); ++first) {
-    if(_timeline.segments[first].size() > 0) { 
+  for(first = 0; first<timeline.segments.size(); ++first) {
+    if(timeline.segments[first].size() > 0) { 
       break; 
     }
   }
   
   // not timeline data to dump
-  if(first == _timeline.segments.size()) {
+  if(first == timeline.segments.size()) {
     os << "{}\n";
     return;
   }
 
-  os << "{\"executor\":\"" << _timeline.uid << "\",\"data\":[";
+  os << "{\"executor\":\"" << timeline.uid << "\",\"data\":[";
 
   bool comma = false;
 
-  for(size_t w=first; w<_timeline.segments.size(); w++) {
-    for(size_t l=0; l<_timeline.segments[w].size(); l++) {
+  for(size_t w=first; w<timeline.segments.size(); w++) {
+    for(size_t l=0; l<timeline.segments[w].size(); l++) {
 
-      if(_timeline.segments[w][l].empty()) {
+      if(timeline.segments[w][l].empty()) {
         continue;
       }
 
@@ -563,19 +822,19 @@ inline void TFProfObserver::dump(std::ostream& os) const {
       }
 
       os << "{\"worker\":" << w << ",\"level\":" << l << ",\"data\":[";
-      for(size_t i=0; i<_timeline.segments[w][l].size(); ++i) {
+      for(size_t i=0; i<timeline.segments[w][l].size(); ++i) {
 
-        const auto& s = _timeline.segments[w][l][i];
+        const auto& s = timeline.segments[w][l][i];
 
         if(i) os << ',';
         
         // span 
         os << "{\"span\":[" 
            << std::chrono::duration_cast<std::chrono::microseconds>(
-                s.beg - _timeline.origin
+                s.beg - timeline.origin
               ).count() << ","
            << std::chrono::duration_cast<std::chrono::microseconds>(
-                s.end - _timeline.origin
+                s.end - timeline.origin
               ).count() << "],";
         
         // name
@@ -609,12 +868,14 @@ inline std::string TFProfObserver::dump() const {
 
 // Function: num_tasks
 inline size_t TFProfObserver::num_tasks() const {
-  return std::accumulate(
-    _timeline.segments.begin(), _timeline.segments.end(), size_t{0}, 
-    [](size_t sum, const auto& exe){ 
-      return sum + exe.size(); 
+  size_t n = 0;
+  for(size_t w=0; w<_timeline.segments.size(); ++w) {
+    std::lock_guard<std::mutex> lock(_mutexes[w]);
+    for(const auto& level : _timeline.segments[w]) {
+      n += level.size();
     }
-  );
+  }
+  return n;
 }
 
 // ----------------------------------------------------------------------------
@@ -639,22 +900,46 @@ class TFProfManager {
 
     void dump(std::ostream& ostream) const;
 
+    // runs a profiler command on all executors of the program
+    // and returns false if the command is malformed or fails:
+    //   start                      attaches a tf::TFProfObserver 
+    //   stop                       detaches the attached observers
+    //   clear                      clears the attached observers
+    //   snapshot <path> [seconds]  writes the last seconds (> 0) to a file
+    bool control(const std::string& command);
+
+    // returns the observer that start attached to the executor, or nullptr
+    std::shared_ptr<TFProfObserver> observer(const Executor& executor) const;
+
   private:
     
     const std::string _fpath;
+    const std::string _cpath;
 
-    std::mutex _mutex;
+    mutable std::mutex _mutex;
     std::vector<std::shared_ptr<TFProfObserver>> _observers;
+    std::vector<std::pair<Executor*, std::shared_ptr<TFProfObserver>>> _executors;
+
+    std::mutex _watch_mutex;
+    std::condition_variable _watch_cv;
+    bool _stop {false};
+    std::thread _watcher;
     
     TFProfManager();
 
     void _manage(std::shared_ptr<TFProfObserver> observer);
+    void _register(Executor* executor);
+    void _unregister(Executor* executor);
+    void _watch();
 };
 
 // constructor
 inline TFProfManager::TFProfManager() :
-  _fpath {get_env(TF_ENABLE_PROFILER)} {
-
+  _fpath {get_env(TF_ENABLE_PROFILER)},
+  _cpath {get_env(TF_PROFILER_CONTROL)} {
+  if(!_cpath.empty()) {
+    _watcher = std::thread([this] () { _watch(); });
+  }
 }
 
 // Procedure: manage
@@ -663,6 +948,55 @@ inline void TFProfManager::_manage(std::shared_ptr<TFProfObserver> observer) {
   _observers.push_back(std::move(observer));
 }
 
+// Procedure: _register
+inline void TFProfManager::_register(Executor* executor) {
+  std::lock_guard lock(_mutex);
+  _executors.emplace_back(executor, nullptr);
+}
+
+// Function: observer
+inline std::shared_ptr<TFProfObserver> TFProfManager::observer(
+  const Executor& executor
+) const {
+  std::lock_guard lock(_mutex);
+  for(const auto& [e, observer] : _executors) {
+    if(e == &executor) {
+      return observer;
+    }
+  }
+  return nullptr;
+}
+
+// Procedure: _watch
+// polls the control file, whose lines are commands to run, and removes
+// the file after reading it
+inline void TFProfManager::_watch() {
+
+  std::unique_lock lock(_watch_mutex);
+
+  auto stopped = [this] () { return _stop; };
+
+  while(!_watch_cv.wait_for(lock, std::chrono::milliseconds(200), stopped)) {
+    
+    std::ifstream ifs(_cpath);
+    
+    if(!ifs) {
+      continue;
+    }
+
+    std::vector<std::string> commands;
+    for(std::string line; std::getline(ifs, line); ) {
+      commands.push_back(std::move(line));
+    }
+    ifs.close();
+    std::remove(_cpath.c_str());
+
+    for(const auto& command : commands) {
+      control(command);
+    }
+  }
+}
+
 // Procedure: dump
 inline void TFProfManager::dump(std::ostream& os) const {
   for(size_t i=0; i<_observers.size(); ++i) {
@@ -673,27 +1007,23 @@ inline void TFProfManager::dump(std::ostream& os) const {
 
 // Destructor
 inline TFProfManager::~TFProfManager() {
-  std::ofstream ofs(_fpath);
-  if(ofs) {
-    // .tfp
-    if(_fpath.rfind(".tfp") != std::string::npos) {
-      ProfileData data;
-      data.timelines.reserve(_observers.size());
-      for(size_t i=0; i<_observers.size(); ++i) {
-        data.timelines.push_back(std::move(_observers[i]->_timeline));
-      }
-      Serializer<std::ofstream> serializer(ofs); 
-      serializer(data);
+
+  if(_watcher.joinable()) {
+    {
+      std::lock_guard lock(_watch_mutex);
+      _stop = true;
     }
-    // .json
-    else {
-      ofs << "[\n";
-      for(size_t i=0; i<_observers.size(); ++i) {
-        if(i) ofs << ',';
-        _observers[i]->dump(ofs);
-      }
-      ofs << "]\n";
+    _watch_cv.notify_one();
+    _watcher.join();
+  }
+
+  if(!_fpath.empty()) {
+    ProfileData data;
+    data.timelines.reserve(_observers.size());
+    for(size_t i=0; i<_observers.size(); ++i) {
+      data.timelines.push_back(std::move(_observers[i]->_timeline));
     }
+    TFProfObserver::_write(_fpath, data);
   }
 }
     
@@ -703,6 +1033,426 @@ inline TFProfManager& TFProfManager::get() {
   return mgr;
 }
 
+// ----------------------------------------------------------------------------
+// TFProfStreamObserver definition
+// ----------------------------------------------------------------------------
+
+/**
+@struct TFProfStreamOptions
+
+@brief structure to configure a tf::TFProfStreamObserver
+*/
+struct TFProfStreamOptions {
+
+  /**
+  @brief number of segments each worker can buffer, rounded up to
+         a power of two
+  */
+  size_t capacity {16384};
+
+  /**
+  @brief time between two chunks written by the background thread
+  */
+  std::chrono::milliseconds interval {1000};
+
+  /**
+  @brief number of bytes after which the observer starts a new file
+  */
+  size_t max_file_size {64 << 20};
+
+  /**
+  @brief number of files to keep, after which the oldest file is removed
+  */
+  size_t max_files {4};
+
+  /**
+  @brief number of distinct task names to intern, after which new names
+         are recorded as unnamed
+  */
+  size_t max_names {65536};
+};
+
+/**
+@class TFProfStreamObserver
+
+@brief observer to stream the thread activities into rotating @TFProf files
+       of bounded size
+
+A tf::TFProfStreamObserver records the same segments as tf::TFProfObserver
+but keeps its memory bounded, so it can stay attached to an executor of
+a long-running program.
+Each worker writes its segments to a lock-free ring buffer of
+tf::TFProfStreamOptions::capacity entries and refers to task names by
+an interned identifier instead of a copy of the name.
+A background thread drains the buffers every
+tf::TFProfStreamOptions::interval and appends them as a chunk,
+i.e., a serialized tf::ProfileData of one timeline,
+to the file <tt>prefix.N.tfp</tt>.
+Once the file exceeds tf::TFProfStreamOptions::max_file_size bytes,
+the observer continues with file <tt>prefix.N+1.tfp</tt> and removes
+the oldest file beyond tf::TFProfStreamOptions::max_files.
+
+@code{.cpp}
+tf::Executor executor;
+
+tf::TFProfStreamOptions options;
+options.interval = std::chrono::milliseconds(500);
+options.max_files = 8;
+
+auto observer = executor.make_observer<tf::TFProfStreamObserver>(
+  "/var/log/service/profile", options
+);
+
+// run taskflows for days ...
+
+observer->flush();  // writes the buffered segments now
+@endcode
+
+A worker that finds its buffer full drops the segment and counts it in
+tf::TFProfStreamObserver::num_dropped, rather than waiting for the
+background thread.
+An observer streams the workers of one executor and throws an exception
+if it is set up again.
+All chunks of an observer share the same executor identifier and origin,
+and each chunk can be loaded with tf::Deserializer as a complete
+tf::ProfileData.
+Setting the environment variable @c TF_ENABLE_STREAM_PROFILER to a path
+prefix attaches a streaming observer to every executor of a program.
+*/
+class TFProfStreamObserver : public ObserverInterface {
+
+  friend class Executor;
+
+  public:
+
+    /**
+    @brief constructs an observer that writes to files of the given prefix
+    */
+    explicit TFProfStreamObserver(
+      std::string prefix, TFProfStreamOptions options = TFProfStreamOptions{}
+    );
+
+    /**
+    @brief writes the buffered segments and stops the background thread
+    */
+    ~TFProfStreamObserver();
+
+    /**
+    @brief writes the buffered segments to the current file now
+    */
+    void flush();
+
+    /**
+    @brief queries the number of segments written to files
+    */
+    size_t num_segments() const;
+
+    /**
+    @brief queries the number of segments dropped because a buffer was full
+    */
+    size_t num_dropped() const;
+
+    /**
+    @brief queries the paths of the files kept by the observer,
+           from the oldest to the newest
+    */
+    std::vector<std::string> files() const;
+
+  private:
+
+    struct Record {
+      observer_stamp_t beg;
+      observer_stamp_t end;
+      uint32_t name;
+      uint32_t level;
+      TaskType type;
+    };
+
+    // single-producer single-consumer ring of records: the worker pushes
+    // and the thread that holds _write_mutex pops
+    struct alignas(64) Lane {
+
+      std::unique_ptr<Record[]> records;
+      size_t mask {0};
+
+      alignas(64) std::atomic<size_t> tail {0};
+      std::atomic<size_t> dropped {0};
+      std::vector<observer_stamp_t> stack;
+      std::unordered_map<std::string, uint32_t> names;
+
+      alignas(64) std::atomic<size_t> head {0};
+    };
+
+    const std::string _prefix;
+    const TFProfStreamOptions _options;
+
+    size_t _uid;
+    observer_stamp_t _origin;
+
+    std::unique_ptr<Lane[]> _lanes;
+    size_t _num_lanes {0};
+
+    std::mutex _names_mutex;
+    std::vector<std::string> _names;
+    std::unordered_map<std::string, uint32_t> _ids;
+
+    mutable std::mutex _write_mutex;
+    std::ofstream _ofs;
+    size_t _file_size {0};
+    size_t _file_index {0};
+    std::deque<std::string> _files;
+    std::atomic<size_t> _num_segments {0};
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _stop {false};
+    std::atomic<bool> _urgent {false};
+    std::thread _thread;
+
+    inline void set_up(size_t num_workers) override final;
+    inline void on_entry(WorkerView, TaskView) override final;
+    inline void on_exit(WorkerView, TaskView) override final;
+
+    uint32_t _intern(Lane&, const std::string&);
+    void _drain();
+    void _write(const ProfileData&);
+};
+
+// Constructor
+inline TFProfStreamObserver::TFProfStreamObserver(
+  std::string prefix, TFProfStreamOptions options
+) :
+  _prefix  {std::move(prefix)},
+  _options {options} {
+  // names never move, so _drain reads them without the lock
+  _names.reserve(_options.max_names + 1);
+  _names.emplace_back();
+}
+
+// Destructor
+inline TFProfStreamObserver::~TFProfStreamObserver() {
+  if(_thread.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _cv.notify_one();
+    _thread.join();
+  }
+  _drain();
+}
+
+// Procedure: set_up
+inline void TFProfStreamObserver::set_up(size_t num_workers) {
+
+  // the buffers and the background thread belong to a single executor
+  if(_thread.joinable()) {
+    TF_THROW("TFProfStreamObserver ", _prefix, " is already set up");
+  }
+
+  _uid = unique_id<size_t>();
+  _origin = observer_stamp_t::clock::now();
+
+  size_t capacity = 1;
+  while(capacity < std::max(_options.capacity, size_t{2})) {
+    capacity <<= 1;
+  }
+
+  _num_lanes = num_workers;
+  _lanes.reset(new Lane[num_workers]);
+  for(size_t w=0; w<num_workers; ++w) {
+    _lanes[w].records.reset(new Record[capacity]);
+    _lanes[w].mask = capacity - 1;
+  }
+
+  _thread = std::thread([this] () {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while(!_stop) {
+      _cv.wait_for(lock, _options.interval, [this] () {
+        return _stop || _urgent.load(std::memory_order_relaxed);
+      });
+      _urgent.store(false, std::memory_order_relaxed);
+      lock.unlock();
+      _drain();
+      lock.lock();
+    }
+  });
+}
+
+// Procedure: on_entry
+inline void TFProfStreamObserver::on_entry(WorkerView wv, TaskView) {
+  _lanes[wv.id()].stack.push_back(observer_stamp_t::clock::now());
+}
+
+// Procedure: on_exit
+inline void TFProfStreamObserver::on_exit(WorkerView wv, TaskView tv) {
+
+  auto& lane = _lanes[wv.id()];
+
+  assert(!lane.stack.empty());
+
+  auto end = observer_stamp_t::clock::now();
+  auto beg = lane.stack.back();
+  lane.stack.pop_back();
+
+  auto t = lane.tail.load(std::memory_order_relaxed);
+  auto n = t - lane.head.load(std::memory_order_acquire);
+
+  if(n > lane.mask) {
+    lane.dropped.store(
+      lane.dropped.load(std::memory_order_relaxed) + 1,
+      std::memory_order_relaxed
+    );
+    return;
+  }
+
+  lane.records[t & lane.mask] = Record{
+    beg, end, _intern(lane, tv.name()),
+    static_cast<uint32_t>(lane.stack.size()), tv.type()
+  };
+  lane.tail.store(t + 1, std::memory_order_release);
+
+  // wakes up the background thread early once a buffer is half full;
+  // a missed notification only delays the drain until the next interval
+  if(n == (lane.mask >> 1)) {
+    _urgent.store(true, std::memory_order_relaxed);
+    _cv.notify_one();
+  }
+}
+
+// Function: _intern
+inline uint32_t TFProfStreamObserver::_intern(Lane& lane, const std::string& name) {
+
+  if(name.empty()) {
+    return 0;
+  }
+
+  if(auto itr = lane.names.find(name); itr != lane.names.end()) {
+    return itr->second;
+  }
+
+  uint32_t id = 0;
+  {
+    std::lock_guard<std::mutex> lock(_names_mutex);
+    if(auto itr = _ids.find(name); itr != _ids.end()) {
+      id = itr->second;
+    }
+    else if(_names.size() <= _options.max_names) {
+      id = static_cast<uint32_t>(_names.size());
+      _names.push_back(name);
+      _ids.emplace(name, id);
+    }
+  }
+
+  // names beyond the limit are not cached so they keep memory bounded
+  if(id) {
+    lane.names.emplace(name, id);
+  }
+
+  return id;
+}
+
+// Procedure: _drain
+inline void TFProfStreamObserver::_drain() {
+
+  std::lock_guard<std::mutex> lock(_write_mutex);
+
+  ProfileData data;
+  data.timelines.resize(1);
+
+  auto& timeline = data.timelines[0];
+  timeline.uid = _uid;
+  timeline.origin = _origin;
+  timeline.segments.resize(_num_lanes);
+
+  size_t num_segments = 0;
+
+  std::vector<size_t> tails(_num_lanes);
+  for(size_t w=0; w<_num_lanes; ++w) {
+    tails[w] = _lanes[w].tail.load(std::memory_order_acquire);
+  }
+
+  // records up to the tails refer only to names interned before this point
+  [[maybe_unused]] size_t num_names;
+  {
+    std::lock_guard<std::mutex> names_lock(_names_mutex);
+    num_names = _names.size();
+  }
+
+  for(size_t w=0; w<_num_lanes; ++w) {
+
+    auto& lane = _lanes[w];
+    auto h = lane.head.load(std::memory_order_relaxed);
+    auto t = tails[w];
+
+    for(; h != t; ++h) {
+      const auto& r = lane.records[h & lane.mask];
+      assert(r.name < num_names);
+      if(r.level >= timeline.segments[w].size()) {
+        timeline.segments[w].resize(r.level + 1);
+      }
+      timeline.segments[w][r.level].emplace_back(
+        _names[r.name], r.type, r.beg, r.end
+      );
+      ++num_segments;
+    }
+
+    lane.head.store(t, std::memory_order_release);
+  }
+
+  if(num_segments) {
+    _write(data);
+    _num_segments.fetch_add(num_segments, std::memory_order_relaxed);
+  }
+}
+
+// Procedure: _write
+inline void TFProfStreamObserver::_write(const ProfileData& data) {
+
+  if(!_ofs.is_open()) {
+    _files.push_back(_prefix + '.' + std::to_string(_file_index++) + ".tfp");
+    _ofs.open(_files.back(), std::ios::binary | std::ios::trunc);
+    _file_size = 0;
+    while(_files.size() > std::max(_options.max_files, size_t{1})) {
+      std::remove(_files.front().c_str());
+      _files.pop_front();
+    }
+  }
+
+  Serializer<std::ofstream> serializer(_ofs);
+  _file_size += static_cast<size_t>(serializer(data));
+  _ofs.flush();
+
+  if(_file_size >= _options.max_file_size) {
+    _ofs.close();
+  }
+}
+
+// Procedure: flush
+inline void TFProfStreamObserver::flush() {
+  _drain();
+}
+
+// Function: num_segments
+inline size_t TFProfStreamObserver::num_segments() const {
+  return _num_segments.load(std::memory_order_relaxed);
+}
+
+// Function: num_dropped
+inline size_t TFProfStreamObserver::num_dropped() const {
+  size_t n = 0;
+  for(size_t w=0; w<_num_lanes; ++w) {
+    n += _lanes[w].dropped.load(std::memory_order_relaxed);
+  }
+  return n;
+}
+
+// Function: files
+inline std::vector<std::string> TFProfStreamObserver::files() const {
+  std::lock_guard<std::mutex> lock(_write_mutex);
+  return {_files.begin(), _files.end()};
+}
+
 // ----------------------------------------------------------------------------
 // Identifier for Each Built-in Observer
 // ----------------------------------------------------------------------------
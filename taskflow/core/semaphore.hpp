@@ -68,6 +68,7 @@ This organization limits the number of concurrently running tasks to only one.
 class Semaphore {
 
   friend class Node;
+  friend class Executor;
 
   public:
     
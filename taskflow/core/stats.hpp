@@ -0,0 +1,401 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "task.hpp"
+
+/**
+@file stats.hpp
+@brief executor statistics include file
+*/
+
+namespace tf {
+
+// ----------------------------------------------------------------------------
+// Class Definition: LatencyHistogram
+// ----------------------------------------------------------------------------
+
+/**
+@class LatencyHistogram
+
+@brief class to count durations in log-linear buckets
+
+A latency histogram splits each power-of-two range of nanoseconds into 
+16 buckets of equal width, so a percentile is exact up to 1/16 of its 
+value, i.e., about 6%, at a fixed size of less than 8 KB.
+
+tf::Executor::latency returns the histogram of the time tasks spend 
+between becoming ready and starting to run.
+
+@code{.cpp}
+auto h = executor.latency();
+std::cout << "p50="  << h.p50().count()  << "ns "
+          << "p99="  << h.p99().count()  << "ns "
+          << "p999=" << h.p999().count() << "ns\n";
+@endcode
+*/
+class LatencyHistogram {
+
+  friend class WorkerCounters;
+
+  public:
+
+    /**
+    @brief number of buckets per power of two
+    */
+    constexpr static size_t num_sub_buckets = 16;
+    
+    /**
+    @brief number of buckets
+    */
+    constexpr static size_t num_buckets = (64 - 3) * num_sub_buckets;
+
+    /**
+    @brief queries the bucket that counts the given number of nanoseconds
+    */
+    static size_t bucket(uint64_t ns) {
+      if(ns < num_sub_buckets) {
+        return static_cast<size_t>(ns);
+      }
+      size_t msb = 63;
+      while(!(ns >> msb)) {
+        --msb;
+      }
+      size_t shift = msb - 4;
+      return (msb - 3) * num_sub_buckets + 
+             static_cast<size_t>((ns >> shift) & (num_sub_buckets - 1));
+    }
+
+    /**
+    @brief queries the largest number of nanoseconds counted by a bucket
+    */
+    static uint64_t upper_bound(size_t b) {
+      if(b < num_sub_buckets) {
+        return b;
+      }
+      size_t msb = b / num_sub_buckets + 3;
+      size_t shift = msb - 4;
+      uint64_t sub = b % num_sub_buckets;
+      return ((num_sub_buckets + sub + 1) << shift) - 1;
+    }
+
+    /**
+    @brief counts a duration
+    */
+    void record(std::chrono::nanoseconds d) {
+      auto ns = static_cast<uint64_t>(std::max(d.count(), decltype(d.count()){0}));
+      _counts[bucket(ns)]++;
+      _count++;
+      _max = std::max(_max, ns);
+    }
+
+    /**
+    @brief adds the counts of another histogram to this histogram
+    */
+    void merge(const LatencyHistogram& rhs) {
+      for(size_t b=0; b<num_buckets; b++) {
+        _counts[b] += rhs._counts[b];
+      }
+      _count += rhs._count;
+      _max = std::max(_max, rhs._max);
+    }
+
+    /**
+    @brief queries the number of counted durations
+    */
+    size_t count() const {
+      return _count;
+    }
+
+    /**
+    @brief queries the number of durations counted by a bucket
+    */
+    size_t count(size_t b) const {
+      return _counts[b];
+    }
+
+    /**
+    @brief queries the longest counted duration
+    */
+    std::chrono::nanoseconds max() const {
+      return std::chrono::nanoseconds(_max);
+    }
+
+    /**
+    @brief queries the duration that the given fraction of durations 
+           does not exceed
+
+    @param p fraction in <tt>[0, 1]</tt>
+
+    @return the upper bound of the bucket of the percentile, 
+            or zero if the histogram is empty
+    */
+    std::chrono::nanoseconds percentile(double p) const {
+      if(_count == 0) {
+        return std::chrono::nanoseconds(0);
+      }
+      auto rank = static_cast<size_t>(std::ceil(p * static_cast<double>(_count)));
+      rank = std::clamp(rank, size_t{1}, _count);
+      size_t n = 0;
+      for(size_t b=0; b<num_buckets; b++) {
+        if((n += _counts[b]) >= rank) {
+          return std::chrono::nanoseconds(std::min(upper_bound(b), _max));
+        }
+      }
+      return std::chrono::nanoseconds(_max);
+    }
+
+    /**
+    @brief queries the median
+    */
+    std::chrono::nanoseconds p50() const { return percentile(0.5); }
+    
+    /**
+    @brief queries the 99th percentile
+    */
+    std::chrono::nanoseconds p99() const { return percentile(0.99); }
+    
+    /**
+    @brief queries the 99.9th percentile
+    */
+    std::chrono::nanoseconds p999() const { return percentile(0.999); }
+
+  private:
+
+    std::array<size_t, num_buckets> _counts {};
+    size_t _count {0};
+    uint64_t _max {0};
+};
+
+// ----------------------------------------------------------------------------
+// Class Definition: WorkerStats
+// ----------------------------------------------------------------------------
+
+/**
+@struct WorkerStats
+
+@brief structure to hold the counters of a worker in an executor
+
+The counters are collected only if the macro @c TF_ENABLE_STATS is defined
+before including %Taskflow, and are all zero otherwise.
+tf::Executor::stats returns a snapshot of the counters of each worker.
+*/
+struct WorkerStats {
+
+  /**
+  @brief number of executed tasks of each type indexed by tf::TaskType
+  */
+  std::array<size_t, TASK_TYPES.size()> num_tasks {};
+
+  /**
+  @brief number of tasks stolen from other queues
+  */
+  size_t num_steals {0};
+
+  /**
+  @brief number of steal attempts that found no task
+  */
+  size_t num_failed_steals {0};
+
+  /**
+  @brief number of tasks stolen from each worker, followed by the number
+         of tasks stolen from the shared queue of the executor
+  */
+  std::vector<size_t> num_steals_from;
+
+  /**
+  @brief number of times the worker yielded while looking for tasks
+  */
+  size_t num_yields {0};
+
+  /**
+  @brief number of times the worker was parked and unparked
+  */
+  size_t num_parks {0};
+
+  /**
+  @brief total time the worker was parked
+  */
+  std::chrono::nanoseconds park_time {0};
+
+  /**
+  @brief maximum number of tasks seen in the queue of the worker
+  */
+  size_t max_queue_size {0};
+
+  /**
+  @brief time the tasks run by the worker spent between becoming ready
+         and starting to run
+  */
+  LatencyHistogram latency;
+
+  /**
+  @brief queries the number of executed tasks of the given type
+  */
+  size_t num_tasks_of(TaskType type) const {
+    return num_tasks[static_cast<size_t>(type)];
+  }
+};
+
+// ----------------------------------------------------------------------------
+// Class Definition: WorkerCounters
+// ----------------------------------------------------------------------------
+
+#ifdef TF_ENABLE_STATS
+
+/**
+@private
+*/
+// The counters of a worker are written only by the worker itself and
+// read by tf::Executor::stats, so relaxed loads and stores suffice.
+// Each worker keeps its counters on cache lines of their own.
+class alignas(64) WorkerCounters {
+
+  friend class Executor;
+
+  using clock = std::chrono::steady_clock;
+
+  public:
+
+    void set_up(size_t num_victims) {
+      _num_victims = num_victims;
+      _num_steals_from.reset(new std::atomic<size_t>[num_victims]);
+      for(size_t i=0; i<num_victims; i++) {
+        _num_steals_from[i].store(0, std::memory_order_relaxed);
+      }
+    }
+
+    void task(TaskType type) {
+      _add(_num_tasks[static_cast<size_t>(type)]);
+    }
+
+    void steal(size_t victim) {
+      _add(_num_steals);
+      _add(_num_steals_from[victim]);
+    }
+
+    void failed_steal() {
+      _add(_num_failed_steals);
+    }
+
+    void yield() {
+      _add(_num_yields);
+    }
+
+    void park() {
+      _add(_num_parks);
+      _parked = clock::now();
+    }
+
+    void unpark() {
+      _add(_park_time, std::chrono::duration_cast<std::chrono::nanoseconds>(
+        clock::now() - _parked
+      ).count());
+    }
+
+    void queue_size(size_t size) {
+      if(size > _max_queue_size.load(std::memory_order_relaxed)) {
+        _max_queue_size.store(size, std::memory_order_relaxed);
+      }
+    }
+
+    void latency(std::chrono::nanoseconds d) {
+      auto ns = static_cast<uint64_t>(std::max(d.count(), decltype(d.count()){0}));
+      _add(_latency[LatencyHistogram::bucket(ns)]);
+      if(ns > _max_latency.load(std::memory_order_relaxed)) {
+        _max_latency.store(ns, std::memory_order_relaxed);
+      }
+    }
+
+    WorkerStats stats() const {
+      WorkerStats s;
+      for(size_t i=0; i<s.num_tasks.size(); i++) {
+        s.num_tasks[i] = _num_tasks[i].load(std::memory_order_relaxed);
+      }
+      s.num_steals = _num_steals.load(std::memory_order_relaxed);
+      s.num_failed_steals = _num_failed_steals.load(std::memory_order_relaxed);
+      for(size_t i=0; i<_num_victims; i++) {
+        s.num_steals_from.push_back(
+          _num_steals_from[i].load(std::memory_order_relaxed)
+        );
+      }
+      s.num_yields = _num_yields.load(std::memory_order_relaxed);
+      s.num_parks = _num_parks.load(std::memory_order_relaxed);
+      s.park_time = std::chrono::nanoseconds(
+        _park_time.load(std::memory_order_relaxed)
+      );
+      s.max_queue_size = _max_queue_size.load(std::memory_order_relaxed);
+      for(size_t b=0; b<LatencyHistogram::num_buckets; b++) {
+        s.latency._counts[b] = _latency[b].load(std::memory_order_relaxed);
+        s.latency._count += s.latency._counts[b];
+      }
+      s.latency._max = _max_latency.load(std::memory_order_relaxed);
+      return s;
+    }
+
+  private:
+
+    std::array<std::atomic<size_t>, TASK_TYPES.size()> _num_tasks {};
+    std::atomic<size_t> _num_steals {0};
+    std::atomic<size_t> _num_failed_steals {0};
+    std::atomic<size_t> _num_yields {0};
+    std::atomic<size_t> _num_parks {0};
+    std::atomic<size_t> _park_time {0};
+    std::atomic<size_t> _max_queue_size {0};
+    
+    std::array<std::atomic<size_t>, LatencyHistogram::num_buckets> _latency {};
+    std::atomic<uint64_t> _max_latency {0};
+
+    size_t _num_victims {0};
+    std::unique_ptr<std::atomic<size_t>[]> _num_steals_from;
+
+    clock::time_point _parked;
+
+    static void _add(std::atomic<size_t>& c, size_t v = 1) {
+      c.store(c.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+    }
+};
+
+#else
+
+/**
+@private
+*/
+// counters that compile to nothing unless TF_ENABLE_STATS is defined
+class WorkerCounters {
+
+  public:
+
+    void set_up(size_t num_victims) {
+      _num_victims = num_victims;
+    }
+
+    void task(TaskType) {}
+    void steal(size_t) {}
+    void failed_steal() {}
+    void yield() {}
+    void park() {}
+    void unpark() {}
+    void queue_size(size_t) {}
+
+    WorkerStats stats() const {
+      WorkerStats s;
+      s.num_steals_from.resize(_num_victims, 0);
+      return s;
+    }
+
+  private:
+
+    size_t _num_victims {0};
+};
+
+#endif
+
+}  // end of namespace tf -----------------------------------------------------
@@ -35,6 +35,8 @@ enum class TaskType : int {
   MODULE,
   /** @brief asynchronous task type */
   ASYNC,
+  /** @brief runtime task type */
+  RUNTIME,
   /** @brief undefined task type (for internal use only) */
   UNDEFINED 
 };
@@ -42,7 +44,7 @@ enum class TaskType : int {
 /**
 @brief array of all task types (used for iterating task types)
 */
-inline constexpr std::array<TaskType, 8> TASK_TYPES = {
+inline constexpr std::array<TaskType, 9> TASK_TYPES = {
   TaskType::PLACEHOLDER,
   TaskType::CUDAFLOW,
   TaskType::SYCLFLOW,
@@ -50,7 +52,8 @@ inline constexpr std::array<TaskType, 8> TASK_TYPES = {
   TaskType::DYNAMIC,
   TaskType::CONDITION,
   TaskType::MODULE,
-  TaskType::ASYNC
+  TaskType::ASYNC,
+  TaskType::RUNTIME
 };
 
 /**
@@ -69,6 +72,7 @@ inline const char* to_string(TaskType type) {
     case TaskType::CONDITION:   val = "condition";   break;
     case TaskType::MODULE:      val = "module";      break;
     case TaskType::ASYNC:       val = "async";       break;
+    case TaskType::RUNTIME:     val = "runtime";     break;
     default:                    val = "undefined";   break;
   }
 
@@ -96,6 +100,15 @@ A dynamic task is a callable object constructible from std::function<void(Subflo
 template <typename C>
 constexpr bool is_dynamic_task_v = std::is_invocable_r_v<void, C, Subflow&>;
 
+/**
+@brief determines if a callable is a runtime task
+
+A runtime task is a callable object constructible from std::function<void(Runtime&)>.
+*/
+template <typename C>
+constexpr bool is_runtime_task_v = std::is_invocable_r_v<void, C, Runtime&> &&
+                                  !std::is_invocable_r_v<void, C, Subflow&>;
+
 /**
 @brief determines if a callable is a condition task
 
@@ -217,6 +230,12 @@ class Task {
     @param callable callable to construct one of the static, dynamic, condition, and cudaFlow tasks
 
     @return @c *this
+
+    If tf::Taskflow::fuse has fused other tasks into this task,
+    a static callable replaces only the work of this task and
+    the fused tasks still run after it.
+    Assigning any other kind of callable to such a task throws
+    an exception, since only a static task can run fused tasks.
     */
     template <typename C>
     Task& work(C&& callable);
@@ -272,6 +291,24 @@ class Task {
     @return @c *this
     */
     Task& data(void* data);
+
+    /**
+    @brief assigns an estimated cost to the task
+
+    @param weight estimated cost of the task, for example, in microseconds
+
+    @return @c *this
+
+    Weights only take effect in taskflows with critical-path scheduling
+    enabled (see tf::Taskflow::critical_path_scheduling), where a worker 
+    continues with the ready successor of the largest weighted path to 
+    a sink.
+    By default, every task has a weight of one, which prioritizes the 
+    successor with the longest path to a sink.
+    Weights can be set from profiled durations using 
+    tf::TFProfObserver::weigh.
+    */
+    Task& weight(size_t weight);
     
     /**
     @brief resets the task handle to null
@@ -325,6 +362,11 @@ class Task {
     */
     void* data() const;
 
+    /**
+    @brief queries the estimated cost of the task
+    */
+    size_t weight() const;
+
 
   private:
     
@@ -462,6 +504,7 @@ inline TaskType Task::type() const {
     case Node::PLACEHOLDER:  return TaskType::PLACEHOLDER;
     case Node::STATIC:       return TaskType::STATIC;
     case Node::DYNAMIC:      return TaskType::DYNAMIC;
+    case Node::RUNTIME:      return TaskType::RUNTIME;
     case Node::CONDITION:    return TaskType::CONDITION;
     case Node::MODULE:       return TaskType::MODULE;
     case Node::ASYNC:        return TaskType::ASYNC;
@@ -504,12 +547,29 @@ inline void Task::dump(std::ostream& os) const {
 // Function: work
 template <typename C>
 Task& Task::work(C&& c) {
+
+  // tasks fused into this task are owned by its static handle
+  if(_node->_handle.index() == Node::STATIC && 
+     !std::get<Node::Static>(_node->_handle).fused.empty()) {
+    if constexpr(is_static_task_v<C>) {
+      auto& h = std::get<Node::Static>(_node->_handle);
+      h.work = std::forward<C>(c);
+      return *this;
+    }
+    else {
+      TF_THROW("task '", _node->_name, "' has fused tasks and must stay static");
+    }
+  }
+
   if constexpr(is_static_task_v<C>) {
     _node->_handle.emplace<Node::Static>(std::forward<C>(c));
   }
   else if constexpr(is_dynamic_task_v<C>) {
     _node->_handle.emplace<Node::Dynamic>(std::forward<C>(c));
   }
+  else if constexpr(is_runtime_task_v<C>) {
+    _node->_handle.emplace<Node::Runtime>(std::forward<C>(c));
+  }
   else if constexpr(is_condition_task_v<C>) {
     _node->_handle.emplace<Node::Condition>(std::forward<C>(c));
   }
@@ -533,6 +593,17 @@ inline Task& Task::data(void* data) {
   return *this;
 }
 
+// Function: weight
+inline size_t Task::weight() const {
+  return _node->_weight;
+}
+
+// Function: weight
+inline Task& Task::weight(size_t weight) {
+  _node->_weight = weight;
+  return *this;
+}
+
 // ----------------------------------------------------------------------------
 // global ostream
 // ----------------------------------------------------------------------------
@@ -648,6 +719,7 @@ inline TaskType TaskView::type() const {
     case Node::PLACEHOLDER:  return TaskType::PLACEHOLDER;
     case Node::STATIC:       return TaskType::STATIC;
     case Node::DYNAMIC:      return TaskType::DYNAMIC;
+    case Node::RUNTIME:      return TaskType::RUNTIME;
     case Node::CONDITION:    return TaskType::CONDITION;
     case Node::MODULE:       return TaskType::MODULE;
     case Node::ASYNC:        return TaskType::ASYNC;
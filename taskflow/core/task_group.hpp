@@ -0,0 +1,192 @@
+#pragma once
+
+#include "executor.hpp"
+
+/**
+@file task_group.hpp
+@brief task group include file
+*/
+
+namespace tf {
+
+// ----------------------------------------------------------------------------
+// class definition: TaskGroup
+// ----------------------------------------------------------------------------
+
+/**
+@class TaskGroup
+
+@brief class to create a group of silent asynchronous tasks that can be
+       waited for and cancelled together
+
+A task group runs the tasks created by tf::TaskGroup::async on its executor
+and keeps a single counter of the pending tasks instead of one future
+per task.
+tf::TaskGroup::wait returns after all tasks of the group have finished.
+
+@code{.cpp}
+tf::Executor executor;
+tf::TaskGroup group(executor);
+
+for(auto& request : requests) {
+  group.async([&request](){ handle(request); });
+}
+
+group.wait();
+@endcode
+
+A worker of the executor that waits for a group keeps executing tasks
+until the group is done, so tasks of a group can create and wait for
+groups of their own without blocking a worker.
+A thread outside the executor that waits for a group also runs tasks
+in the same way as tf::Executor::run_and_wait.
+
+tf::TaskGroup::cancel marks the group as cancelled, after which pending
+tasks of the group return without calling their callables.
+Tasks that are already running finish normally.
+
+tf::TaskGroup::async is thread-safe.
+The group must be destroyed before its executor, and the destructor
+waits for all tasks of the group to finish.
+While a group has pending tasks, it counts as one submission for
+tf::Executor::wait_for_all.
+*/
+class TaskGroup {
+
+  friend class Executor;
+
+  public:
+
+    /**
+    @brief constructs a task group that runs its tasks on the given executor
+    */
+    explicit TaskGroup(Executor& executor);
+
+    /**
+    @brief disabled copy constructor
+    */
+    TaskGroup(const TaskGroup&) = delete;
+
+    /**
+    @brief disabled copy assignment
+    */
+    TaskGroup& operator = (const TaskGroup&) = delete;
+
+    /**
+    @brief waits for all tasks of the group to finish and destructs the group
+    */
+    ~TaskGroup();
+
+    /**
+    @brief runs a callable asynchronously as a task of the group
+
+    @tparam F callable type
+    @tparam ArgsT parameter types
+
+    @param f callable object to call
+    @param args parameters to pass to the callable
+
+    The callable does not run if the group is cancelled before the task
+    starts.
+    */
+    template <typename F, typename... ArgsT>
+    void async(F&& f, ArgsT&&... args);
+
+    /**
+    @brief waits for all tasks of the group to finish
+
+    A worker of the executor, or a thread outside the executor that is not
+    already running tasks in tf::Executor::run_and_wait, runs pending tasks
+    while waiting.
+    */
+    void wait();
+
+    /**
+    @brief cancels the tasks of the group that have not started yet
+
+    The group stays cancelled, so the tasks created by later calls to
+    tf::TaskGroup::async do not run either.
+    */
+    void cancel();
+
+    /**
+    @brief queries if the group has been cancelled
+    */
+    bool is_cancelled() const;
+
+    /**
+    @brief queries the number of tasks of the group that have not finished
+    */
+    size_t num_pending() const;
+
+  private:
+
+    // the state is released by the group and by each of its tasks
+    struct State : public BulkTopology {
+      std::atomic<bool> cancelled {false};
+    };
+
+    Executor& _executor;
+
+    State* _state;
+};
+
+// Constructor
+inline TaskGroup::TaskGroup(Executor& executor) :
+  _executor {executor},
+  _state    {new State()} {
+  _state->_is_group = true;
+  _state->_pending.store(1, std::memory_order_relaxed);
+}
+
+// Destructor
+inline TaskGroup::~TaskGroup() {
+  wait();
+  _executor._release_bulk(_state);
+}
+
+// Function: async
+template <typename F, typename... ArgsT>
+void TaskGroup::async(F&& f, ArgsT&&... args) {
+
+  // the first pending task makes the group a submission of its own
+  if(_state->_pending.fetch_add(1, std::memory_order_relaxed) == 1) {
+    _executor._increment_topology();
+  }
+
+  auto node = node_pool.animate(
+    std::in_place_type_t<Node::SilentAsync>{},
+    [s=_state, f=std::forward<F>(f), args...] () mutable {
+      if(!s->cancelled.load(std::memory_order_relaxed)) {
+        f(args...);
+      }
+    },
+    static_cast<BulkTopology*>(_state)
+  );
+
+  _executor._schedule(node);
+}
+
+// Procedure: wait
+inline void TaskGroup::wait() {
+  _executor._wait_until([s=_state] () {
+    return s->_pending.load(std::memory_order_acquire) == 1;
+  });
+}
+
+// Procedure: cancel
+inline void TaskGroup::cancel() {
+  _state->cancelled.store(true, std::memory_order_relaxed);
+}
+
+// Function: is_cancelled
+inline bool TaskGroup::is_cancelled() const {
+  return _state->cancelled.load(std::memory_order_relaxed);
+}
+
+// Function: num_pending
+inline size_t TaskGroup::num_pending() const {
+  return _state->_pending.load(std::memory_order_relaxed) - 1;
+}
+
+}  // end of namespace tf -----------------------------------------------------
@@ -164,16 +164,236 @@ class Taskflow : public FlowBuilder {
     template <typename V>
     void for_each_task(V&& visitor) const;
 
+    /**
+    @brief removes redundant dependencies from the taskflow
+
+    @return the number of removed dependencies
+
+    A dependency from task @c A to task @c B is redundant if @c B is also 
+    reachable from @c A through other tasks, for example, 
+    <tt>A->C</tt> is redundant when <tt>A->B->C</tt> exists.
+    Every dependency costs an atomic operation and memory at run time,
+    and graphs generated by programs often contain many of them.
+    This method performs a transitive reduction on the taskflow graph 
+    and removes duplicate dependencies between the same two tasks, 
+    without changing the order in which tasks can run.
+
+    @code{.cpp}
+    auto [A, B, C] = taskflow.emplace(
+      [](){ std::cout << "A\n"; }, 
+      [](){ std::cout << "B\n"; }, 
+      [](){ std::cout << "C\n"; }
+    );
+    A.precede(B, C);
+    B.precede(C);
+    
+    assert(taskflow.optimize() == 1);  // removes A->C
+    @endcode
+    
+    Condition tasks are left alone: their successors are never removed and
+    a path only makes a dependency redundant if it goes through tasks 
+    that are neither condition tasks nor successors of condition tasks, 
+    which only run after all their dependents have finished.
+    Subflows and composed taskflows are not affected.
+    
+    You should never optimize a taskflow while it is being run by an executor.
+    */
+    size_t optimize();
+
+    /**
+    @brief fuses linear chains of static tasks into single tasks
+
+    @return the number of tasks fused into other tasks
+
+    Each task costs scheduling overhead at run time, which dominates 
+    long chains of tiny static tasks.
+    This method finds every maximal chain of static tasks in which each 
+    task has a single successor and the next task has a single dependent,
+    and merges the chain into its first task, which then runs the 
+    callables of the chain in order.
+    The first task takes over the successors of the last task of the chain,
+    and the other tasks are removed from the taskflow graph.
+    Tasks that acquire or release semaphores are never fused.
+
+    @code{.cpp}
+    auto [A, B, C, D] = taskflow.emplace(
+      [](){ std::cout << "A\n"; }, 
+      [](){ std::cout << "B\n"; }, 
+      [](){ std::cout << "C\n"; },
+      [](){ std::cout << "D\n"; }
+    );
+    A.precede(B);
+    B.precede(C);
+    C.precede(D);
+    
+    assert(taskflow.fuse() == 3);      // A runs A, B, C, and D
+    assert(taskflow.num_tasks() == 1);
+    @endcode
+
+    Observers still see every fused task as a task of its own, 
+    with the worker running the chain.
+    Task handles to the fused tasks remain valid until the taskflow is
+    cleared or destroyed, but they no longer have dependencies and must 
+    not be modified.
+    The head of a chain keeps its fused tasks when tf::Task::work 
+    assigns it another static callable, and throws an exception if 
+    the new callable is not static.
+    
+    You should never fuse a taskflow while it is being run by an executor.
+    */
+    size_t fuse();
+
+    /**
+    @brief enables or disables critical-path scheduling of the taskflow
+
+    @param enable whether to enable critical-path scheduling
+
+    When enabled, every run of the taskflow first computes for each task 
+    the largest total weight (see tf::Task::weight) of a path from the 
+    task to a sink, which costs one pass over the graph.
+    When a task finishes, its worker continues with the ready successor 
+    of the largest path weight and leaves the other ready successors to 
+    idle workers, so the critical path does not wait behind shorter 
+    branches.
+    By default, a worker continues with the last ready successor.
+    
+    @code{.cpp}
+    taskflow.critical_path_scheduling(true);
+    executor.run(taskflow).wait();
+    @endcode
+    */
+    void critical_path_scheduling(bool enable);
+
+    /**
+    @brief queries if critical-path scheduling is enabled
+    */
+    bool critical_path_scheduling() const;
+
+    /**
+    @brief sets the maximum number of runs of the taskflow that execute
+           at the same time
+
+    @param n the maximum number of concurrent runs, which must be at least one
+
+    By default, an executor runs the submissions of a taskflow one after 
+    another.
+    With a limit of @c n, up to @c n-1 submissions that arrive while 
+    the taskflow is running start immediately on a private copy of the 
+    taskflow graph.
+    The executor keeps the copies released by finished runs and reuses 
+    them until the taskflow becomes idle, when the graph may be modified.
+    The tasks of a copy invoke the callables of the taskflow itself, 
+    which must hence be safe to invoke concurrently.
+    Submissions beyond the limit wait as usual.
+    
+    @code{.cpp}
+    taskflow.max_concurrent_runs(4);
+    for(auto& request : requests) {
+      executor.run(taskflow);  // up to four runs execute at the same time
+    }
+    executor.wait_for_all();
+    @endcode
+
+    Module tasks, cudaFlow tasks, and syclFlow tasks cannot run 
+    concurrently with themselves, and running a taskflow with such tasks
+    and a limit greater than one throws an exception.
+    A tf::Pipeline task keeps its state in the pipeline object and must 
+    not run concurrently with itself.
+    */
+    void max_concurrent_runs(size_t n);
+
+    /**
+    @brief queries the maximum number of runs of the taskflow that execute
+           at the same time
+    */
+    size_t max_concurrent_runs() const;
+
+    /**
+    @brief sets the maximum number of iterations of a run that execute
+           at the same time
+
+    @param K the maximum number of overlapping iterations, which must be 
+             at least one
+
+    By default, tf::Executor::run_n and tf::Executor::run_until start an
+    iteration of the taskflow only after the previous iteration has 
+    finished.
+    With a limit of @c K, a run executes iteration @c k on the @c k%K-th
+    of @c K private copies of the taskflow graph, and starts it as soon as 
+    iteration @c k-K has finished, so the sources of the next iterations
+    can run while the tail of the current iteration is still running.
+    The first copy is the graph of the run itself.
+    The stopping predicate decides whether to start each further iteration
+    and may hence be called before the previous iterations have finished.
+    The copies are reused and invoke the task callables with the same 
+    caveats as tf::Taskflow::max_concurrent_runs.
+    
+    @code{.cpp}
+    taskflow.max_overlapping_iterations(3);
+    executor.run_n(taskflow, 100).wait();  // up to three iterations at a time
+    @endcode
+    
+    Running a taskflow with module tasks, cudaFlow tasks, or syclFlow tasks
+    and a limit greater than one throws an exception.
+    */
+    void max_overlapping_iterations(size_t K);
+
+    /**
+    @brief queries the maximum number of iterations of a run that execute
+           at the same time
+    */
+    size_t max_overlapping_iterations() const;
+
+    /**
+    @brief enables or disables the ordering of tasks across overlapping 
+           iterations
+
+    @param enable whether every task runs in the order of iterations
+
+    When enabled, each task of an iteration starts only after the same
+    task has finished in the previous iteration, which keeps tasks that
+    update state across iterations (e.g., a task reading the next frame 
+    of a stream) in order while other tasks of the iterations overlap.
+    Taskflows with condition tasks cannot guarantee the order since a 
+    task may run any number of times in an iteration, and always run their
+    iterations one after another when ordering is enabled.
+    
+    @code{.cpp}
+    taskflow.max_overlapping_iterations(4);
+    taskflow.ordered_iterations(true);
+    @endcode
+    */
+    void ordered_iterations(bool enable);
+    
+    /**
+    @brief queries if tasks are ordered across overlapping iterations
+    */
+    bool ordered_iterations() const;
+
   private:
     
     mutable std::mutex _mutex;
  
     std::string _name;
+
+    bool _critical_path_scheduling {false};
+
+    size_t _max_concurrent_runs {1};
+
+    size_t _max_overlapping_iterations {1};
+
+    bool _ordered_iterations {false};
    
     Graph _graph;
 
     std::queue<std::shared_ptr<Topology>> _topologies;
 
+    std::list<std::shared_ptr<Topology>> _concurrent_topologies;
+
+    // copies of the graph released by concurrent runs and overlapping 
+    // iterations for reuse until the taskflow is idle again
+    std::vector<std::unique_ptr<Graph>> _clones;
+
     std::optional<std::list<Taskflow>::iterator> _satellite;
     
     void _dump(std::ostream&, const Taskflow*) const;
@@ -197,8 +417,14 @@ inline Taskflow::Taskflow(Taskflow&& rhs) : FlowBuilder{_graph} {
   std::scoped_lock<std::mutex> lock(rhs._mutex);
   
   _name = std::move(rhs._name);
+  _critical_path_scheduling = rhs._critical_path_scheduling;
+  _max_concurrent_runs = rhs._max_concurrent_runs;
+  _max_overlapping_iterations = rhs._max_overlapping_iterations;
+  _ordered_iterations = rhs._ordered_iterations;
   _graph = std::move(rhs._graph); 
   _topologies = std::move(rhs._topologies);
+  _concurrent_topologies = std::move(rhs._concurrent_topologies);
+  _clones = std::move(rhs._clones);
   _satellite = rhs._satellite;
 
   rhs._satellite.reset();
@@ -209,8 +435,14 @@ inline Taskflow& Taskflow::operator = (Taskflow&& rhs) {
   if(this != &rhs) {
     std::scoped_lock<std::mutex, std::mutex> lock(_mutex, rhs._mutex);
     _name = std::move(rhs._name);
+    _critical_path_scheduling = rhs._critical_path_scheduling;
+    _max_concurrent_runs = rhs._max_concurrent_runs;
+    _max_overlapping_iterations = rhs._max_overlapping_iterations;
+    _ordered_iterations = rhs._ordered_iterations;
     _graph = std::move(rhs._graph); 
     _topologies = std::move(rhs._topologies);
+    _concurrent_topologies = std::move(rhs._concurrent_topologies);
+    _clones = std::move(rhs._clones);
     _satellite = rhs._satellite;
     rhs._satellite.reset();
   }
@@ -242,6 +474,61 @@ inline const std::string& Taskflow::name() const {
   return _name;
 }
 
+// Procedure: critical_path_scheduling
+inline void Taskflow::critical_path_scheduling(bool enable) {
+  // equal levels fall back to the default order
+  if(!enable) {
+    for(auto node : _graph._nodes) {
+      node->_level = 0;
+    }
+  }
+  _critical_path_scheduling = enable;
+}
+
+// Function: critical_path_scheduling
+inline bool Taskflow::critical_path_scheduling() const {
+  return _critical_path_scheduling;
+}
+
+// Procedure: max_concurrent_runs
+inline void Taskflow::max_concurrent_runs(size_t n) {
+  if(n == 0) {
+    TF_THROW("must allow at least one run");
+  }
+  std::lock_guard<std::mutex> lock(_mutex);
+  _max_concurrent_runs = n;
+}
+
+// Function: max_concurrent_runs
+inline size_t Taskflow::max_concurrent_runs() const {
+  return _max_concurrent_runs;
+}
+
+// Procedure: max_overlapping_iterations
+inline void Taskflow::max_overlapping_iterations(size_t K) {
+  if(K == 0) {
+    TF_THROW("must allow at least one iteration");
+  }
+  std::lock_guard<std::mutex> lock(_mutex);
+  _max_overlapping_iterations = K;
+}
+
+// Function: max_overlapping_iterations
+inline size_t Taskflow::max_overlapping_iterations() const {
+  return _max_overlapping_iterations;
+}
+
+// Procedure: ordered_iterations
+inline void Taskflow::ordered_iterations(bool enable) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _ordered_iterations = enable;
+}
+
+// Function: ordered_iterations
+inline bool Taskflow::ordered_iterations() const {
+  return _ordered_iterations;
+}
+
 // Function: for_each_task
 template <typename V>
 void Taskflow::for_each_task(V&& visitor) const {
@@ -250,6 +537,225 @@ void Taskflow::for_each_task(V&& visitor) const {
   }
 }
 
+// Function: optimize
+inline size_t Taskflow::optimize() {
+
+  auto& nodes = _graph._nodes;
+
+  const size_t N = nodes.size();
+
+  // successor indices of all tasks in compressed rows
+  std::vector<size_t> offsets(N + 1, 0);
+  std::vector<size_t> successors;
+  {
+    std::unordered_map<Node*, size_t> index;
+    index.reserve(N);
+    for(size_t i=0; i<N; i++) {
+      index[nodes[i]] = i;
+      offsets[i+1] = offsets[i] + nodes[i]->_successors.size();
+    }
+    successors.reserve(offsets[N]);
+    for(size_t i=0; i<N; i++) {
+      for(auto s : nodes[i]->_successors) {
+        successors.push_back(index.at(s));
+      }
+    }
+  }
+
+  // topological ranks over strong dependencies; tasks on a cycle keep
+  // the rank N and are left alone
+  std::vector<size_t> rank(N, N);
+  std::vector<size_t> pending(N);
+  std::vector<size_t> queue;
+  
+  for(size_t i=0; i<N; i++) {
+    if((pending[i] = nodes[i]->num_strong_dependents()) == 0) {
+      queue.push_back(i);
+    }
+  }
+
+  for(size_t r=0; r<queue.size(); r++) {
+    size_t x = queue[r];
+    rank[x] = r;
+    if(nodes[x]->_handle.index() == Node::CONDITION) {
+      continue;
+    }
+    for(size_t e=offsets[x]; e<offsets[x+1]; e++) {
+      if(--pending[successors[e]] == 0) {
+        queue.push_back(successors[e]);
+      }
+    }
+  }
+
+  // a task reached by a path through eligible tasks only is guaranteed to
+  // run after the path source
+  std::vector<unsigned char> eligible(N);
+  for(size_t i=0; i<N; i++) {
+    eligible[i] = rank[i] < N &&
+                  nodes[i]->_handle.index() != Node::CONDITION && 
+                  nodes[i]->num_weak_dependents() == 0;
+  }
+
+  // stamps of the current source task, offset by one
+  std::vector<size_t> expanded(N, 0);
+  std::vector<size_t> reached(N, 0);
+  std::vector<size_t> kept(N, 0);
+  std::vector<size_t> stack;
+
+  size_t num_removed = 0;
+
+  for(size_t u=0; u<N; u++) {
+
+    Node* node = nodes[u];
+    
+    if(node->_handle.index() == Node::CONDITION || rank[u] == N ||
+       offsets[u+1] - offsets[u] <= 1) {
+      continue;
+    }
+
+    const size_t t = u + 1;
+
+    // a successor can only be reached through tasks of a lower rank
+    size_t limit = 0;
+    for(size_t e=offsets[u]; e<offsets[u+1]; e++) {
+      limit = std::max(limit, rank[successors[e]]);
+    }
+
+    // marks every task reachable from u by a path of two or more edges,
+    // up to the rank limit
+    auto expand = [&] (size_t i) {
+      if(eligible[i] && rank[i] < limit && expanded[i] != t) {
+        expanded[i] = t;
+        stack.push_back(i);
+      }
+    };
+
+    for(size_t e=offsets[u]; e<offsets[u+1]; e++) {
+      expand(successors[e]);
+    }
+
+    while(!stack.empty()) {
+      size_t x = stack.back();
+      stack.pop_back();
+      for(size_t e=offsets[x]; e<offsets[x+1]; e++) {
+        reached[successors[e]] = t;
+        expand(successors[e]);
+      }
+    }
+
+    // removes redundant and duplicate successors in place; the compressed 
+    // rows still hold the original edges, which reach the same tasks
+    size_t k = 0;
+
+    for(size_t e=offsets[u]; e<offsets[u+1]; e++) {
+
+      size_t i = successors[e];
+      Node* v = nodes[i];
+
+      if(reached[i] != t && kept[i] != t) {
+        kept[i] = t;
+        node->_successors[k++] = v;
+        continue;
+      }
+
+      auto& deps = v->_dependents;
+      deps.erase(std::find(deps.begin(), deps.end(), node));
+      ++num_removed;
+    }
+
+    node->_successors.resize(k);
+  }
+
+  return num_removed;
+}
+
+// Function: fuse
+inline size_t Taskflow::fuse() {
+
+  auto fusable = [] (Node* node) {
+    return node->_handle.index() == Node::STATIC && (!node->_semaphores || (
+      node->_semaphores->to_acquire.empty() && 
+      node->_semaphores->to_release.empty()
+    ));
+  };
+
+  // whether the node continues the chain of its only dependent
+  auto continues = [&] (Node* node) {
+    return node->_dependents.size() == 1 && fusable(node) &&
+           node->_dependents[0] != node &&
+           node->_dependents[0]->_successors.size() == 1 &&
+           fusable(node->_dependents[0]);
+  };
+
+  auto& nodes = _graph._nodes;
+
+  // a task continuing a chain is fused unless the chain is a cycle
+  std::vector<unsigned char> continuing(nodes.size());
+  for(size_t i=0; i<nodes.size(); i++) {
+    continuing[i] = continues(nodes[i]);
+  }
+
+  for(size_t i=0; i<nodes.size(); i++) {
+
+    Node* head = nodes[i];
+
+    if(continuing[i] || !fusable(head)) {
+      continue;
+    }
+
+    auto& chain = std::get<Node::Static>(head->_handle).fused;
+
+    Node* tail = head;
+
+    while(tail->_successors.size() == 1 && continues(tail->_successors[0])) {
+      
+      Node* node = tail->_successors[0];
+      
+      if(tail != head) {
+        tail->_successors.clear();
+      }
+      node->_dependents.clear();
+
+      // keeps the tasks fused into the node by an earlier call in order
+      auto& nested = std::get<Node::Static>(node->_handle).fused;
+      chain.push_back(node);
+      chain.insert(chain.end(), nested.begin(), nested.end());
+      nested.clear();
+
+      tail = node;
+    }
+
+    if(tail == head) {
+      continue;
+    }
+
+    // the head takes over the successors of the tail
+    head->_successors.clear();
+
+    for(auto s : tail->_successors) {
+      head->_successors.push_back(s);
+      *std::find(s->_dependents.begin(), s->_dependents.end(), tail) = head;
+    }
+
+    tail->_successors.clear();
+  }
+
+  // fused nodes are now owned by their heads and have no dependents
+  size_t k = 0;
+
+  for(size_t i=0; i<nodes.size(); i++) {
+    if(!continuing[i] || !nodes[i]->_dependents.empty()) {
+      nodes[k++] = nodes[i];
+    }
+  }
+
+  size_t num_fused = nodes.size() - k;
+
+  nodes.resize(k);
+
+  return num_fused;
+}
+
 // Procedure: dump
 inline std::string Taskflow::dump() const {
   std::ostringstream oss;
@@ -410,6 +916,17 @@ inline void Taskflow::_dump(
   }
 }
 
+// ----------------------------------------------------------------------------
+// Definition for Topology
+// ----------------------------------------------------------------------------
+
+// Function: _graph
+// returns the graph this run executes; the first slot of a run with 
+// overlapping iterations executes the graph of the run
+inline Graph& Topology::_graph() {
+  return _clone ? *_clone : (_run ? _run->_graph() : _taskflow._graph);
+}
+
 // ----------------------------------------------------------------------------
 // class definition: Future
 // ----------------------------------------------------------------------------
@@ -24,12 +24,36 @@ class TopologyBase {
 class AsyncTopology : public TopologyBase {
 };
 
+// ----------------------------------------------------------------------------
+
+// class: BulkTopology
+// The silent asynchronous tasks of one bulk submission share a derived 
+// state, which the last of them to tear down deletes.
+// A task group holds one reference to its state as long as it lives and
+// counts as a submission while any of its tasks is pending.
+class BulkTopology {
+  
+  friend class Executor;
+  friend class TaskGroup;
+
+  public:
+
+    virtual ~BulkTopology() = default;
+
+  private:
+
+    std::atomic<size_t> _pending {0};
+
+    bool _is_group {false};
+};
+
 // ----------------------------------------------------------------------------
   
 // class: Topology
 class Topology : public TopologyBase {
   
   friend class Executor;
+  friend class Node;
 
   public:
 
@@ -48,6 +72,23 @@ class Topology : public TopologyBase {
     std::function<void()> _call;
 
     std::atomic<size_t> _join_counter {0};
+
+    // private copy of the taskflow graph if this run is concurrent to
+    // another run of the same taskflow
+    std::unique_ptr<Graph> _clone;
+
+    // A run with overlapping iterations runs iteration k in slot k % K, 
+    // each slot being a topology of its own on a copy of the graph, except
+    // for slot 0, which runs the graph of the run.
+    // Ordered iterations pass a token per task and slot to the next slot.
+    Topology* _run {nullptr};
+    std::vector<std::unique_ptr<Topology>> _slots;
+    std::deque<Semaphore> _tokens;
+    size_t _num_iterations {0};
+    bool _is_stopped {false};
+    bool _is_running {false};
+
+    Graph& _graph();
 };
 
 // Constructor
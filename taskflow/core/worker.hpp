@@ -3,6 +3,7 @@
 #include "declarations.hpp"
 #include "tsq.hpp"
 #include "notifier.hpp"
+#include "stats.hpp"
 
 /** 
 @file worker.hpp
@@ -27,6 +28,7 @@ class Worker {
     Notifier::Waiter* _waiter;
     std::default_random_engine _rdgen { std::random_device{}() };
     TaskQueue<Node*> _wsq;
+    WorkerCounters _counters;
 };
 
 /**
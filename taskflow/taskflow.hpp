@@ -1,10 +1,14 @@
 #pragma once
 
 #include "core/executor.hpp"
+#include "core/task_group.hpp"
 #include "core/algorithm/critical.hpp"
 #include "core/algorithm/for_each.hpp"
 #include "core/algorithm/reduce.hpp"
 #include "core/algorithm/sort.hpp"
+#include "core/algorithm/compact.hpp"
+#include "core/algorithm/pipeline.hpp"
+#include "core/algorithm/wavefront.hpp"
 
 
 /** @dir taskflow
@@ -126,6 +126,13 @@ class ObjectPool {
     */
     template <typename... ArgsT>
     T* animate(ArgsT&&... args);
+
+    /**
+    @brief acquires pointers to @c n objects at once, the @c i-th of which is
+           constructed from the argument tuple returned by @c args(i)
+    */
+    template <typename C>
+    void animate_n(T** objects, size_t n, C&& args);
     
     /**
     @brief recycles a object pointed by @c ptr and destroys it
@@ -171,6 +178,7 @@ class ObjectPool {
     size_t _bin(size_t) const;
 
     T* _allocate(Block*);
+    T* _acquire(LocalHeap&, Block*&);
 
     void _deallocate(Block*, T*);
     void _blocklist_init_head(Blocklist*);
@@ -573,19 +581,13 @@ void ObjectPool<T, S>::_deallocate(Block* s, T* ptr) {
   s->top = ptr;
 }
 
-// Function: allocate
+// Function: _acquire
+// takes the memory of one object from the given heap, whose lock 
+// must be held, and stores its superblock in s
 template <typename T, size_t S>
-template <typename... ArgsT>
-T* ObjectPool<T, S>::animate(ArgsT&&... args) {
-
-  //std::cout << "construct a new item\n";
-  
-  // my logically mapped heap
-  LocalHeap& h = _this_heap(); 
-  
-  Block* s {nullptr};
+T* ObjectPool<T, S>::_acquire(LocalHeap& h, Block*& s) {
 
-  h.mutex.lock();
+  s = nullptr;
   
   // scan the list of superblocks from most full to least
   int f = static_cast<int>(F-1);
@@ -663,6 +665,23 @@ T* ObjectPool<T, S>::animate(ArgsT&&... args) {
   //          << "h.u " << h.u  << '\n'
   //          << "h.a " << h.a  << '\n';
 
+  return mem;
+}
+
+// Function: allocate
+template <typename T, size_t S>
+template <typename... ArgsT>
+T* ObjectPool<T, S>::animate(ArgsT&&... args) {
+
+  //std::cout << "construct a new item\n";
+  
+  // my logically mapped heap
+  LocalHeap& h = _this_heap(); 
+  
+  Block* s {nullptr};
+
+  h.mutex.lock();
+  T* mem = _acquire(h, s);
   h.mutex.unlock();
 
   //printf("allocate %p (s=%p)\n", mem, s);
@@ -673,6 +692,33 @@ T* ObjectPool<T, S>::animate(ArgsT&&... args) {
 
   return mem;
 }
+
+// Function: animate_n
+template <typename T, size_t S>
+template <typename C>
+void ObjectPool<T, S>::animate_n(T** objects, size_t n, C&& args) {
+
+  LocalHeap& h = _this_heap(); 
+
+  // the superblock of each object is kept in its memory until the object
+  // is constructed, like the free list does
+  h.mutex.lock();
+  for(size_t i=0; i<n; ++i) {
+    Block* s {nullptr};
+    objects[i] = _acquire(h, s);
+    *(reinterpret_cast<Block**>(objects[i])) = s;
+  }
+  h.mutex.unlock();
+
+  for(size_t i=0; i<n; ++i) {
+    T* mem = objects[i];
+    Block* s = *(reinterpret_cast<Block**>(mem));
+    std::apply([mem] (auto&&... a) {
+      new (mem) T(std::forward<decltype(a)>(a)...);
+    }, args(i));
+    mem->_object_pool_block = s;
+  }
+}
   
 // Function: destruct
 template <typename T, size_t S>
@@ -20,6 +20,7 @@
 #include <unordered_set>
 #include <sstream>
 #include <list>
+#include <deque>
 #include <forward_list>
 #include <numeric>
 #include <random>
@@ -27,9 +28,12 @@
 #include <cassert>
 #include <cmath>
 #include <array>
+#include <utility>
+#include <limits>
 #include <cstring>
 #include <variant>
 #include <optional>
+#include <tuple>
 //#include <any>
 
 namespace tf {
@@ -102,6 +106,22 @@ struct get_index<T, std::variant<Ts...>> : get_index_impl<0, T, Ts...>{};
 template <typename T, typename... Ts>
 constexpr auto get_index_v = get_index<T, Ts...>::value;
 
+// ----------------------------------------------------------------------------
+// std::tuple
+// ----------------------------------------------------------------------------
+
+// invokes func on the idx-th element of the given tuple
+template <typename Func, typename Tuple, size_t N = 0>
+void visit_tuple(Func func, Tuple& tup, size_t idx) {
+  if (N == idx) {
+    std::invoke(func, std::get<N>(tup));
+    return;
+  }
+  if constexpr (N + 1 < std::tuple_size_v<Tuple>) {
+    return visit_tuple<Func, Tuple, N + 1>(func, tup, idx);
+  }
+}
+
 // ----------------------------------------------------------------------------
 // is_pod
 //-----------------------------------------------------------------------------
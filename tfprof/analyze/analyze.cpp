@@ -0,0 +1,431 @@
+// 3rd-party include
+
+#include <CLI11/CLI11.hpp>
+
+#include <taskflow/taskflow.hpp>
+
+namespace tf {
+
+// ----------------------------------------------------------------------------
+// ProfileReader
+// ----------------------------------------------------------------------------
+
+// Class: ProfileReader
+// reads a .tfp file one segment at a time in the layout of ProfileData,
+// so the memory does not grow with the size of the file;
+// a file streamed by tf::TFProfStreamObserver is a sequence of ProfileData
+class ProfileReader {
+
+  public:
+
+  ProfileReader(const std::string& fpath) : _buffer(1 << 20) {
+    _ifs.rdbuf()->pubsetbuf(_buffer.data(), _buffer.size());
+    _ifs.open(fpath, std::ios::binary);
+    if(!_ifs) {
+      TF_THROW("failed to open profile data ", fpath);
+    }
+  }
+
+  // calls on_timeline(uid, origin, num_workers) for each timeline and
+  // on_segment(uid, worker, level, segment) for each of its segments
+  template <typename T, typename S>
+  void read(T&& on_timeline, S&& on_segment) {
+
+    Deserializer<std::ifstream> deserializer(_ifs);
+
+    Segment segment;
+
+    // a truncated file, e.g., of a crashed program, ends on a failed read
+    auto check = [this] () {
+      if(!_ifs) {
+        TF_THROW("truncated profile data");
+      }
+    };
+
+    auto size = [&] () {
+      size_t n;
+      deserializer(make_size_tag(n));
+      check();
+      return n;
+    };
+
+    while(_ifs.peek() != std::ifstream::traits_type::eof()) {
+
+      for(size_t t=0, num_timelines=size(); t<num_timelines; t++) {
+
+        size_t uid;
+        observer_stamp_t origin;
+        deserializer(uid, origin);
+
+        size_t num_workers = size();
+
+        on_timeline(uid, origin, num_workers);
+
+        for(size_t w=0; w<num_workers; w++) {
+          for(size_t l=0, num_levels=size(); l<num_levels; l++) {
+            for(size_t i=0, num_segments=size(); i<num_segments; i++) {
+              deserializer(segment);
+              check();
+              on_segment(uid, w, l, segment);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  private:
+
+  std::vector<char> _buffer;
+  std::ifstream _ifs;
+};
+
+// ----------------------------------------------------------------------------
+// Analyzer
+// ----------------------------------------------------------------------------
+
+class Analyzer {
+
+  public:
+
+  using nanoseconds = std::chrono::nanoseconds;
+
+  Analyzer(size_t num_buckets, size_t top) :
+    _num_buckets {std::max(num_buckets, size_t{1})},
+    _top         {top} {
+  }
+
+  void timeline(size_t uid, observer_stamp_t origin, size_t num_workers) {
+    auto& e = _executors[uid];
+    e.origin = origin;
+    if(e.workers.size() < num_workers) {
+      e.workers.resize(num_workers);
+      for(auto& worker : e.workers) {
+        worker.buckets.resize(_num_buckets, nanoseconds{0});
+      }
+    }
+  }
+
+  void segment(size_t uid, size_t w, size_t l, const Segment& s) {
+
+    auto& e = _executors[uid];
+    auto& worker = e.workers[w];
+
+    auto beg = _offset(e, s.beg);
+    auto end = _offset(e, s.end);
+    auto dur = end - beg;
+
+    // task statistics
+    auto& task = _tasks[s.name];
+    task.count++;
+    task.total += dur;
+    task.max = std::max(task.max, dur);
+    task.buckets[LatencyHistogram::bucket(static_cast<uint64_t>(dur.count()))]++;
+
+    _push(_segments, Longest{dur, s.name, s.type, uid, w, l, beg, end});
+
+    // nested tasks run within their parents and do not add to the time
+    // a worker is busy
+    if(l != 0) {
+      return;
+    }
+
+    worker.num_tasks++;
+    worker.busy += dur;
+
+    if(worker.num_tasks == 1) {
+      worker.first = beg;
+    }
+    else if(beg > worker.last) {
+      auto gap = beg - worker.last;
+      worker.idle += gap;
+      _push(_gaps, Longest{gap, "", s.type, uid, w, l, worker.last, beg});
+    }
+    worker.last = std::max(worker.last, end);
+
+    _add_busy_time(worker, beg, end);
+  }
+
+  void report(std::ostream& os, size_t num_names) const {
+    _report_tasks(os, num_names);
+    _report_utilization(os);
+    _report_longest(os, "longest idle gaps", _gaps, false);
+    _report_longest(os, "longest tasks", _segments, true);
+  }
+
+  private:
+
+  struct Task {
+    size_t count {0};
+    nanoseconds total {0};
+    nanoseconds max {0};
+    // sparse tf::LatencyHistogram buckets, as most tasks of a name
+    // take similar time
+    std::map<size_t, size_t> buckets;
+  };
+
+  struct Worker {
+    size_t num_tasks {0};
+    nanoseconds busy {0};
+    nanoseconds idle {0};
+    nanoseconds first {0};
+    nanoseconds last {0};
+    std::vector<nanoseconds> buckets;
+  };
+
+  struct Executor {
+    observer_stamp_t origin;
+    std::vector<Worker> workers;
+  };
+
+  struct Longest {
+    nanoseconds span;
+    std::string name;
+    TaskType type;
+    size_t uid, w, l;
+    nanoseconds beg, end;
+
+    bool operator < (const Longest& rhs) const {
+      return span > rhs.span;
+    }
+  };
+
+  const size_t _num_buckets;
+  const size_t _top;
+
+  nanoseconds _width {std::chrono::milliseconds(1)};
+
+  std::map<size_t, Executor> _executors;
+  std::unordered_map<std::string, Task> _tasks;
+
+  // min-heaps that keep the longest spans
+  std::priority_queue<Longest> _segments;
+  std::priority_queue<Longest> _gaps;
+
+  static nanoseconds _offset(const Executor& e, observer_stamp_t t) {
+    return std::max(
+      nanoseconds{0}, std::chrono::duration_cast<nanoseconds>(t - e.origin)
+    );
+  }
+
+  void _push(std::priority_queue<Longest>& heap, Longest&& item) {
+    if(heap.size() < _top) {
+      heap.push(std::move(item));
+    }
+    else if(_top && heap.top().span < item.span) {
+      heap.pop();
+      heap.push(std::move(item));
+    }
+  }
+
+  // the buckets of all workers share one width, which doubles whenever
+  // a task ends beyond the last bucket
+  void _add_busy_time(Worker& worker, nanoseconds beg, nanoseconds end) {
+
+    const auto N = static_cast<nanoseconds::rep>(_num_buckets);
+
+    while(end >= _width * N) {
+      for(auto& [uid, e] : _executors) {
+        for(auto& wk : e.workers) {
+          for(size_t b=0; b<_num_buckets; b++) {
+            wk.buckets[b/2] = (b % 2) ? wk.buckets[b/2] + wk.buckets[b] :
+                                        wk.buckets[b];
+          }
+          std::fill(
+            wk.buckets.begin() + (_num_buckets + 1) / 2, wk.buckets.end(),
+            nanoseconds{0}
+          );
+        }
+      }
+      _width *= 2;
+    }
+
+    for(auto b = beg / _width; b <= end / _width; b++) {
+      auto lo = std::max(beg, _width * b);
+      auto hi = std::min(end, _width * (b + 1));
+      if(hi > lo) {
+        worker.buckets[static_cast<size_t>(b)] += hi - lo;
+      }
+    }
+  }
+
+  static std::string _format(nanoseconds d) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(3);
+    auto ns = static_cast<double>(d.count());
+    if(ns < 1e3)      oss << ns << "ns";
+    else if(ns < 1e6) oss << ns / 1e3 << "us";
+    else if(ns < 1e9) oss << ns / 1e6 << "ms";
+    else              oss << ns / 1e9 << "s";
+    return oss.str();
+  }
+
+  static std::string _percent(nanoseconds part, nanoseconds whole) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(1)
+        << (whole.count() ? 100.0 * part.count() / whole.count() : 0.0) << '%';
+    return oss.str();
+  }
+
+  static nanoseconds _percentile(const Task& task, double p) {
+    auto rank = static_cast<size_t>(std::ceil(p * task.count));
+    rank = std::clamp(rank, size_t{1}, task.count);
+    size_t n = 0;
+    for(auto [b, c] : task.buckets) {
+      if((n += c) >= rank) {
+        return std::min(
+          nanoseconds(LatencyHistogram::upper_bound(b)), task.max
+        );
+      }
+    }
+    return task.max;
+  }
+
+  void _report_tasks(std::ostream& os, size_t num_names) const {
+
+    std::vector<std::pair<const std::string*, const Task*>> tasks;
+    for(const auto& [name, task] : _tasks) {
+      tasks.emplace_back(&name, &task);
+    }
+    std::sort(tasks.begin(), tasks.end(), [](const auto& a, const auto& b){
+      return a.second->total > b.second->total;
+    });
+
+    os << "tasks (" << _tasks.size() << " names, by total time)\n"
+       << std::left  << std::setw(32) << "name" << std::right
+       << std::setw(12) << "count" << std::setw(14) << "total"
+       << std::setw(14) << "mean"  << std::setw(14) << "p99"
+       << std::setw(14) << "max"   << '\n';
+
+    for(size_t i=0; i<std::min(num_names, tasks.size()); i++) {
+      auto& [name, task] = tasks[i];
+      os << std::left  << std::setw(32) << (name->empty() ? "(unnamed)" : *name)
+         << std::right << std::setw(12) << task->count
+         << std::setw(14) << _format(task->total)
+         << std::setw(14) << _format(task->total / task->count)
+         << std::setw(14) << _format(_percentile(*task, 0.99))
+         << std::setw(14) << _format(task->max) << '\n';
+    }
+    os << '\n';
+  }
+
+  void _report_utilization(std::ostream& os) const {
+
+    os << "utilization (" << _format(_width)
+       << " per bucket from the start of each executor)\n"
+       << std::left << std::setw(16) << "worker" << std::right
+       << std::setw(10) << "tasks" << std::setw(14) << "busy"
+       << std::setw(14) << "idle" << std::setw(8) << "util" << "  buckets\n";
+
+    for(const auto& [uid, e] : _executors) {
+      for(size_t w=0; w<e.workers.size(); w++) {
+
+        const auto& worker = e.workers[w];
+
+        std::ostringstream name;
+        name << 'E' << uid << ".W" << w;
+
+        os << std::left  << std::setw(16) << name.str() << std::right
+           << std::setw(10) << worker.num_tasks
+           << std::setw(14) << _format(worker.busy)
+           << std::setw(14) << _format(worker.idle)
+           << std::setw(8)  << _percent(worker.busy, worker.last - worker.first)
+           << ' ';
+
+        for(size_t b=0; b<worker.buckets.size(); b++) {
+          os << ' ' << std::setw(6) << _percent(worker.buckets[b], _width);
+        }
+        os << '\n';
+      }
+    }
+    os << '\n';
+  }
+
+  void _report_longest(
+    std::ostream& os, const char* title,
+    std::priority_queue<Longest> heap, bool tasks
+  ) const {
+
+    std::vector<Longest> items;
+    while(!heap.empty()) {
+      items.push_back(heap.top());
+      heap.pop();
+    }
+    std::reverse(items.begin(), items.end());
+
+    os << title << '\n'
+       << std::left << std::setw(16) << "worker" << std::right
+       << std::setw(16) << "from" << std::setw(16) << "to"
+       << std::setw(14) << "span";
+    if(tasks) {
+      os << "  " << std::left << std::setw(16) << "type" << "name";
+    }
+    os << '\n';
+
+    for(const auto& item : items) {
+      std::ostringstream name;
+      name << 'E' << item.uid << ".W" << item.w;
+      if(tasks) {
+        name << ".L" << item.l;
+      }
+      os << std::left << std::setw(16) << name.str() << std::right
+         << std::setw(16) << _format(item.beg)
+         << std::setw(16) << _format(item.end)
+         << std::setw(14) << _format(item.span);
+      if(tasks) {
+        os << "  " << std::left << std::setw(16) << to_string(item.type)
+           << (item.name.empty() ? "(unnamed)" : item.name);
+      }
+      os << '\n';
+    }
+    os << '\n';
+  }
+};
+
+}  // end of namespace tf -----------------------------------------------------
+
+int main(int argc, char* argv[]) {
+
+  // parse arguments
+  CLI::App app{"tfprof-analyze"};
+
+  std::vector<std::string> inputs;
+  app.add_option("inputs", inputs, "input profiling files (.tfp) in time order")
+     ->required();
+
+  size_t num_names {20};
+  app.add_option("-k,--names", num_names, "task names to list (default=20)");
+
+  size_t num_buckets {10};
+  app.add_option("-b,--buckets", num_buckets, "utilization buckets per worker (default=10)");
+
+  size_t top {10};
+  app.add_option("-n,--top", top, "longest tasks and idle gaps to list (default=10)");
+
+  CLI11_PARSE(app, argc, argv);
+
+  tf::Analyzer analyzer(num_buckets, top);
+
+  // reports the data read before an error, such as the last chunk
+  // of a program that crashed while writing it
+  for(const auto& input : inputs) {
+    try {
+      tf::ProfileReader reader(input);
+      reader.read(
+        [&](size_t uid, tf::observer_stamp_t origin, size_t num_workers) {
+          analyzer.timeline(uid, origin, num_workers);
+        },
+        [&](size_t uid, size_t w, size_t l, const tf::Segment& s) {
+          analyzer.segment(uid, w, l, s);
+        }
+      );
+    }
+    catch(const std::exception& e) {
+      std::cerr << input << ": " << e.what() << '\n';
+    }
+  }
+
+  analyzer.report(std::cout, num_names);
+
+  return EXIT_SUCCESS;
+}
@@ -152,7 +152,37 @@ class Database {
     
     ProfileData pd;
     tf::Deserializer<std::ifstream> deserializer(ifs);
-    deserializer(pd);
+
+    // a file streamed by tf::TFProfStreamObserver is a sequence of chunks,
+    // each of which continues the timeline of the same executor
+    while(ifs.peek() != std::ifstream::traits_type::eof()) {
+      ProfileData chunk;
+      deserializer(chunk);
+      for(auto& timeline : chunk.timelines) {
+        auto itr = std::find_if(pd.timelines.begin(), pd.timelines.end(), 
+          [&](const auto& t){ return t.uid == timeline.uid; }
+        );
+        if(itr == pd.timelines.end()) {
+          pd.timelines.push_back(std::move(timeline));
+          continue;
+        }
+        if(itr->segments.size() < timeline.segments.size()) {
+          itr->segments.resize(timeline.segments.size());
+        }
+        for(size_t w=0; w<timeline.segments.size(); w++) {
+          auto& levels = itr->segments[w];
+          if(levels.size() < timeline.segments[w].size()) {
+            levels.resize(timeline.segments[w].size());
+          }
+          for(size_t l=0; l<timeline.segments[w].size(); l++) {
+            levels[l].insert(levels[l].end(), 
+              std::make_move_iterator(timeline.segments[w][l].begin()),
+              std::make_move_iterator(timeline.segments[w][l].end())
+            );
+          }
+        }
+      }
+    }
     
     // find the minimum starting point
 
@@ -8,6 +8,8 @@
 #include <chrono>
 #include <limits.h>
 #include <array>
+#include <list>
+#include <map>
 
 // --------------------------------------------------------
 // Testcase: for_each
@@ -534,6 +536,216 @@ TEST_CASE("statefulpfg.12threads" * doctest::timeout(300)) {
 //  stateful_for_each(12, STATIC);
 //}
 
+// ----------------------------------------------------------------------------
+// for_each_index_2d and for_each_index_3d
+// ----------------------------------------------------------------------------
+
+void for_each_index_2d(unsigned W) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  for(int r=0; r<=130; r=r*2+3) {
+    for(int c=0; c<=200; c=c*3+1) {
+      for(size_t t : {1, 7, 64}) {
+
+        std::vector<std::atomic<int>> visited(r*c);
+        for(auto& v : visited) {
+          v = 0;
+        }
+
+        taskflow.clear();
+        taskflow.for_each_index_2d(-1, r-1, 2, c+2, t, 2*t, [&](int i, int j){
+          visited[(i+1)*c + (j-2)]++;
+        });
+        executor.run(taskflow).wait();
+
+        for(auto& v : visited) {
+          REQUIRE(v == 1);
+        }
+      }
+    }
+  }
+
+  // default tile size
+  std::vector<std::atomic<int>> visited(1000*300);
+  for(auto& v : visited) {
+    v = 0;
+  }
+
+  taskflow.clear();
+  taskflow.for_each_index_2d(0, 1000, 0, 300, [&](int i, int j){
+    visited[i*300 + j]++;
+  });
+  executor.run(taskflow).wait();
+
+  for(auto& v : visited) {
+    REQUIRE(v == 1);
+  }
+}
+
+TEST_CASE("pf2d.1thread" * doctest::timeout(300)) {
+  for_each_index_2d(1);
+}
+
+TEST_CASE("pf2d.2threads" * doctest::timeout(300)) {
+  for_each_index_2d(2);
+}
+
+TEST_CASE("pf2d.3threads" * doctest::timeout(300)) {
+  for_each_index_2d(3);
+}
+
+TEST_CASE("pf2d.4threads" * doctest::timeout(300)) {
+  for_each_index_2d(4);
+}
+
+void for_each_index_3d(unsigned W) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  for(size_t n0 : {0, 1, 17, 40}) {
+    for(size_t n1 : {0, 5, 33}) {
+      for(size_t n2 : {1, 16, 50}) {
+
+        std::vector<std::atomic<int>> visited(n0*n1*n2);
+        for(auto& v : visited) {
+          v = 0;
+        }
+
+        taskflow.clear();
+        taskflow.for_each_index_3d(
+          size_t{0}, n0, size_t{0}, n1, size_t{0}, n2, 
+          [&](size_t i, size_t j, size_t k){
+            visited[(i*n1 + j)*n2 + k]++;
+          }
+        );
+        executor.run(taskflow).wait();
+
+        for(auto& v : visited) {
+          REQUIRE(v == 1);
+        }
+
+        for(auto& v : visited) {
+          v = 0;
+        }
+        
+        taskflow.clear();
+        taskflow.for_each_index_3d(
+          size_t{0}, n0, size_t{0}, n1, size_t{0}, n2, 3, 5, 7,
+          [&](size_t i, size_t j, size_t k){
+            visited[(i*n1 + j)*n2 + k]++;
+          }
+        );
+        executor.run(taskflow).wait();
+
+        for(auto& v : visited) {
+          REQUIRE(v == 1);
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("pf3d.1thread" * doctest::timeout(300)) {
+  for_each_index_3d(1);
+}
+
+TEST_CASE("pf3d.2threads" * doctest::timeout(300)) {
+  for_each_index_3d(2);
+}
+
+TEST_CASE("pf3d.3threads" * doctest::timeout(300)) {
+  for_each_index_3d(3);
+}
+
+TEST_CASE("pf3d.4threads" * doctest::timeout(300)) {
+  for_each_index_3d(4);
+}
+
+// ----------------------------------------------------------------------------
+// for_each over non-random-access ranges
+// ----------------------------------------------------------------------------
+
+void forward_for_each(unsigned W) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  for(size_t n : {0, 1, 2, 3, 7, 16, 17, 100, 1000, 12345}) {
+
+    std::list<int> list(n, 0);
+    std::map<size_t, int> map;
+    for(size_t i=0; i<n; i++) {
+      map[i] = 0;
+    }
+
+    std::atomic<size_t> counter {0};
+
+    taskflow.clear();
+    taskflow.for_each(list.begin(), list.end(), [&](int& i){
+      counter++;
+      i++;
+    });
+    taskflow.for_each(map.begin(), map.end(), [&](auto& kv){
+      counter++;
+      kv.second++;
+    });
+    executor.run(taskflow).wait();
+
+    REQUIRE(counter == 2*n);
+
+    for(auto i : list) {
+      REQUIRE(i == 1);
+    }
+
+    for(auto& kv : map) {
+      REQUIRE(kv.second == 1);
+    }
+  }
+}
+
+TEST_CASE("forward_for_each.1thread" * doctest::timeout(300)) {
+  forward_for_each(1);
+}
+
+TEST_CASE("forward_for_each.2threads" * doctest::timeout(300)) {
+  forward_for_each(2);
+}
+
+TEST_CASE("forward_for_each.3threads" * doctest::timeout(300)) {
+  forward_for_each(3);
+}
+
+TEST_CASE("forward_for_each.4threads" * doctest::timeout(300)) {
+  forward_for_each(4);
+}
+
+TEST_CASE("split_forward_range" * doctest::timeout(300)) {
+
+  for(size_t n=0; n<=300; n++) {
+    std::list<size_t> list(n);
+    std::iota(list.begin(), list.end(), 0);
+    for(size_t K=1; K<=8; K++) {
+      auto bounds = tf::split_forward_range(list.begin(), list.end(), K);
+      size_t N = bounds.size() - 1;
+      REQUIRE(bounds.front() == list.begin());
+      REQUIRE(bounds.back() == list.end());
+      REQUIRE(N <= std::max(size_t{1}, 2*K));
+      REQUIRE(N >= std::min(std::max(n, size_t{1}), K));
+      // all chunks but the last one have the same size
+      size_t size = std::distance(bounds[0], bounds[1]);
+      for(size_t i=1; i+1<N; i++) {
+        REQUIRE(std::distance(bounds[i], bounds[i+1]) == size);
+      }
+      if(N > 1) {
+        REQUIRE(std::distance(bounds[N-1], bounds[N]) <= size);
+      }
+    }
+  }
+}
+
 // --------------------------------------------------------
 // Testcase: reduce
 // --------------------------------------------------------
@@ -1099,3 +1311,663 @@ TEST_CASE("ps.object.4.100000") {
 }
 
 
+
+TEST_CASE("ps.int.2.1000000") {
+  ps_pod<int>(2, 1000000);
+}
+
+TEST_CASE("ps.int.4.1000000") {
+  ps_pod<int>(4, 1000000);
+}
+
+TEST_CASE("ps.ldouble.3.1000000") {
+  ps_pod<long double>(3, 1000000);
+}
+
+// sorts inputs of typical patterns large enough to be partitioned in parallel
+void ps_pattern(size_t W, size_t N) {
+
+  std::vector<std::vector<int>> patterns(5, std::vector<int>(N));
+
+  for(size_t i=0; i<N; i++) {
+    patterns[0][i] = static_cast<int>(i);          // ascending
+    patterns[1][i] = static_cast<int>(N - i);      // descending
+    patterns[2][i] = 7;                            // all equal
+    patterns[3][i] = ::rand() % 4;                 // few unique values
+    patterns[4][i] = (i < N/2) ? static_cast<int>(i) : ::rand(); // sorted half
+  }
+
+  tf::Executor executor(W);
+  
+  for(auto& data : patterns) {
+
+    auto gold = data;
+    std::sort(gold.begin(), gold.end());
+
+    tf::Taskflow taskflow;
+    taskflow.sort(data.begin(), data.end());
+    executor.run(taskflow).wait();
+
+    REQUIRE(data == gold);
+  }
+}
+
+TEST_CASE("ps.pattern.2.1000000") {
+  ps_pattern(2, 1000000);
+}
+
+TEST_CASE("ps.pattern.4.1000000") {
+  ps_pattern(4, 1000000);
+}
+
+TEST_CASE("ps.pattern.7.1000000") {
+  ps_pattern(7, 1000000);
+}
+
+// ----------------------------------------------------------------------------
+// Parallel Sort by Key
+// ----------------------------------------------------------------------------
+
+void sort_by_key(size_t W, size_t N) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  std::vector<int> keys(N);
+  std::vector<std::string> values(N);
+  std::vector<std::pair<int, std::string>> gold(N);
+
+  for(size_t i=0; i<N; i++) {
+    keys[i] = ::rand() % 1000;
+    values[i] = std::to_string(i);
+    gold[i] = {keys[i], values[i]};
+  }
+
+  taskflow.sort_by_key(keys.begin(), keys.end(), values.begin());
+  executor.run(taskflow).wait();
+
+  REQUIRE(std::is_sorted(keys.begin(), keys.end()));
+
+  // every key must still be paired with its original value
+  std::vector<std::pair<int, std::string>> res(N);
+  for(size_t i=0; i<N; i++) {
+    res[i] = {keys[i], values[i]};
+  }
+  std::sort(gold.begin(), gold.end());
+  std::sort(res.begin(), res.end());
+  REQUIRE(res == gold);
+}
+
+TEST_CASE("sort_by_key.1.100000") {
+  sort_by_key(1, 100000);
+}
+
+TEST_CASE("sort_by_key.2.1000000") {
+  sort_by_key(2, 1000000);
+}
+
+TEST_CASE("sort_by_key.4.1000000") {
+  sort_by_key(4, 1000000);
+}
+
+TEST_CASE("sort_by_key.Descending") {
+
+  tf::Executor executor(3);
+  tf::Taskflow taskflow;
+
+  size_t N = 100000;
+
+  std::vector<float> keys(N);
+  std::vector<size_t> values(N);
+  std::iota(values.begin(), values.end(), 0);
+
+  for(size_t i=0; i<N; i++) {
+    keys[i] = static_cast<float>(i);
+  }
+
+  taskflow.sort_by_key(
+    keys.begin(), keys.end(), 
+    values.begin(), std::greater<float>{}
+  );
+  executor.run(taskflow).wait();
+
+  for(size_t i=0; i<N; i++) {
+    REQUIRE(values[i] == N-1-i);
+    REQUIRE(keys[i] == static_cast<float>(N-1-i));
+  }
+}
+
+// ----------------------------------------------------------------------------
+// Parallel Argsort
+// ----------------------------------------------------------------------------
+
+void argsort(size_t W, size_t N) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  std::vector<double> data(N);
+  std::vector<size_t> perm(N);
+
+  for(auto& d : data) {
+    d = ::rand() % 1000 - 500;
+  }
+
+  auto copy = data;
+
+  taskflow.argsort(data.begin(), data.end(), perm.begin());
+  executor.run(taskflow).wait();
+
+  // data is untouched
+  REQUIRE(data == copy);
+
+  // perm is a permutation that sorts data
+  std::vector<size_t> seen(perm);
+  std::sort(seen.begin(), seen.end());
+  for(size_t i=0; i<N; i++) {
+    REQUIRE(seen[i] == i);
+  }
+
+  for(size_t i=1; i<N; i++) {
+    REQUIRE(data[perm[i-1]] <= data[perm[i]]);
+  }
+}
+
+TEST_CASE("argsort.1.100000") {
+  argsort(1, 100000);
+}
+
+TEST_CASE("argsort.2.1000000") {
+  argsort(2, 1000000);
+}
+
+TEST_CASE("argsort.4.1000000") {
+  argsort(4, 1000000);
+}
+
+// ----------------------------------------------------------------------------
+// Parallel Compaction
+// ----------------------------------------------------------------------------
+
+void copy_if(size_t W, size_t N) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  std::vector<int> data(N), out(N, -1);
+  std::vector<int>::iterator res;
+
+  for(auto& d : data) {
+    d = ::rand() % 100;
+  }
+
+  auto pred = [] (int v) { return v % 3 == 0; };
+
+  std::vector<int> gold;
+  std::copy_if(data.begin(), data.end(), std::back_inserter(gold), pred);
+
+  taskflow.copy_if(data.begin(), data.end(), out.begin(), pred, res);
+  executor.run(taskflow).wait();
+
+  REQUIRE(res - out.begin() == static_cast<int>(gold.size()));
+  REQUIRE(std::equal(gold.begin(), gold.end(), out.begin()));
+  REQUIRE(std::all_of(res, out.end(), [] (int v) { return v == -1; }));
+}
+
+TEST_CASE("copy_if.1.100000") {
+  copy_if(1, 100000);
+}
+
+TEST_CASE("copy_if.2.1000000") {
+  copy_if(2, 1000000);
+}
+
+TEST_CASE("copy_if.4.1000000") {
+  copy_if(4, 1000000);
+}
+
+void remove_if(size_t W, size_t N, int modulo) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  std::vector<std::string> data(N);
+  std::vector<std::string>::iterator res;
+
+  for(auto& d : data) {
+    d = std::to_string(::rand() % 1000);
+  }
+
+  auto pred = [modulo] (const std::string& s) { 
+    return std::stoi(s) % modulo == 0; 
+  };
+
+  auto gold = data;
+  gold.erase(std::remove_if(gold.begin(), gold.end(), pred), gold.end());
+
+  taskflow.remove_if(data.begin(), data.end(), pred, res);
+  executor.run(taskflow).wait();
+
+  data.erase(res, data.end());
+
+  REQUIRE(data == gold);
+}
+
+TEST_CASE("remove_if.1.100000") {
+  remove_if(1, 100000, 2);
+}
+
+TEST_CASE("remove_if.2.1000000") {
+  remove_if(2, 1000000, 2);
+  remove_if(2, 1000000, 1);
+  remove_if(2, 1000000, 1001);
+}
+
+TEST_CASE("remove_if.4.1000000") {
+  remove_if(4, 1000000, 7);
+  remove_if(4, 1000000, 1);
+  remove_if(4, 1000000, 1001);
+}
+
+void unique(size_t W, size_t N) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  std::vector<int> data(N);
+  std::vector<int>::iterator res;
+
+  for(auto& d : data) {
+    d = ::rand() % 4;
+  }
+
+  auto gold = data;
+  gold.erase(std::unique(gold.begin(), gold.end()), gold.end());
+
+  taskflow.unique(data.begin(), data.end(), res);
+  executor.run(taskflow).wait();
+
+  data.erase(res, data.end());
+
+  REQUIRE(data == gold);
+}
+
+TEST_CASE("unique.1.100000") {
+  unique(1, 100000);
+}
+
+TEST_CASE("unique.2.1000000") {
+  unique(2, 1000000);
+}
+
+TEST_CASE("unique.4.1000000") {
+  unique(4, 1000000);
+}
+
+void partition(size_t W, size_t N) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  std::vector<std::unique_ptr<int>> data(N);
+  std::vector<std::unique_ptr<int>>::iterator res;
+  std::vector<int> gold(N);
+
+  for(size_t i=0; i<N; i++) {
+    data[i] = std::make_unique<int>(::rand());
+    gold[i] = *data[i];
+  }
+
+  auto pred = [] (int v) { return v % 2 == 0; };
+  
+  std::stable_partition(gold.begin(), gold.end(), pred);
+
+  taskflow.partition(
+    data.begin(), data.end(), 
+    [pred] (const std::unique_ptr<int>& p) { return pred(*p); }, res
+  );
+  executor.run(taskflow).wait();
+
+  REQUIRE(res - data.begin() == std::count_if(gold.begin(), gold.end(), pred));
+  
+  for(size_t i=0; i<N; i++) {
+    REQUIRE(*data[i] == gold[i]);
+  }
+}
+
+TEST_CASE("partition.1.100000") {
+  partition(1, 100000);
+}
+
+TEST_CASE("partition.2.1000000") {
+  partition(2, 1000000);
+}
+
+TEST_CASE("partition.4.1000000") {
+  partition(4, 1000000);
+}
+
+// ----------------------------------------------------------------------------
+// Parallel Histogram
+// ----------------------------------------------------------------------------
+
+void histogram(size_t W, size_t N, size_t K) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  std::vector<int> data(N);
+  std::vector<size_t> bins(K, 1), gold(K, 1);
+
+  for(auto& d : data) {
+    d = ::rand() % (K + 10);   // some elements fall outside the bins
+  }
+
+  for(auto d : data) {
+    if(static_cast<size_t>(d) < K) {
+      ++gold[d];
+    }
+  }
+
+  taskflow.histogram(data.begin(), data.end(), bins, [] (int v) { 
+    return static_cast<size_t>(v); 
+  });
+  executor.run(taskflow).wait();
+
+  REQUIRE(bins == gold);
+}
+
+TEST_CASE("histogram.1.100000") {
+  histogram(1, 100000, 100);
+}
+
+TEST_CASE("histogram.2.1000000") {
+  histogram(2, 1000000, 16);
+  histogram(2, 1000000, 10000);
+}
+
+TEST_CASE("histogram.4.1000000") {
+  histogram(4, 1000000, 16);
+  histogram(4, 1000000, 10000);
+  histogram(4, 1000000, 1000000);
+}
+
+// ----------------------------------------------------------------------------
+// Parallel Reduce by Key
+// ----------------------------------------------------------------------------
+
+void reduce_by_key(size_t W, size_t N, int max_run) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  std::vector<int> keys(N), values(N);
+  std::vector<int> ukeys(N), sums(N);
+  std::vector<int> gold_keys, gold_sums;
+  std::pair<std::vector<int>::iterator, std::vector<int>::iterator> ends;
+
+  for(size_t i=0, k=0; i<N; k++) {
+    size_t run = std::min(N - i, static_cast<size_t>(::rand() % max_run + 1));
+    gold_keys.push_back(static_cast<int>(k % 3));   // equal keys in non-adjacent runs
+    gold_sums.push_back(0);
+    for(size_t j=0; j<run; j++, i++) {
+      keys[i] = static_cast<int>(k % 3);
+      values[i] = ::rand() % 10;
+      gold_sums.back() += values[i];
+    }
+  }
+
+  taskflow.reduce_by_key(
+    keys.begin(), keys.end(), values.begin(), ukeys.begin(), sums.begin(),
+    std::plus<int>{}, ends
+  );
+  executor.run(taskflow).wait();
+
+  REQUIRE(ends.first - ukeys.begin() == static_cast<int>(gold_keys.size()));
+  REQUIRE(ends.second - sums.begin() == static_cast<int>(gold_sums.size()));
+  REQUIRE(std::equal(gold_keys.begin(), gold_keys.end(), ukeys.begin()));
+  REQUIRE(std::equal(gold_sums.begin(), gold_sums.end(), sums.begin()));
+}
+
+TEST_CASE("reduce_by_key.1.100000") {
+  reduce_by_key(1, 100000, 10);
+}
+
+TEST_CASE("reduce_by_key.2.1000000") {
+  reduce_by_key(2, 1000000, 1);
+  reduce_by_key(2, 1000000, 10);
+  reduce_by_key(2, 1000000, 1000000);
+}
+
+TEST_CASE("reduce_by_key.4.1000000") {
+  reduce_by_key(4, 1000000, 1);
+  reduce_by_key(4, 1000000, 100);
+  reduce_by_key(4, 1000000, 1000000);
+}
+
+// ----------------------------------------------------------------------------
+// Parallel Wavefront
+// ----------------------------------------------------------------------------
+
+void wavefront(unsigned W, int R, int C) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  std::vector<std::atomic<int>> done(R*C);
+  for(auto& d : done) {
+    d = 0;
+  }
+
+  std::atomic<bool> ordered {true};
+
+  taskflow.wavefront(R, C, [&](int i, int j){
+    if((i > 0 && done[(i-1)*C + j] != 1) || (j > 0 && done[i*C + j-1] != 1)) {
+      ordered = false;
+    }
+    done[i*C + j]++;
+  });
+
+  executor.run(taskflow).wait();
+
+  REQUIRE(ordered);
+  for(auto& d : done) {
+    REQUIRE(d == 1);
+  }
+}
+
+TEST_CASE("wavefront.1thread" * doctest::timeout(300)) {
+  for(int r=0; r<=64; r=r*2+1) {
+    for(int c=0; c<=64; c=c*2+1) {
+      wavefront(1, r, c);
+    }
+  }
+}
+
+TEST_CASE("wavefront.2threads" * doctest::timeout(300)) {
+  for(int r=0; r<=64; r=r*2+1) {
+    for(int c=0; c<=64; c=c*2+1) {
+      wavefront(2, r, c);
+    }
+  }
+}
+
+TEST_CASE("wavefront.4threads" * doctest::timeout(300)) {
+  for(int r=0; r<=64; r=r*2+1) {
+    for(int c=0; c<=64; c=c*2+1) {
+      wavefront(4, r, c);
+    }
+  }
+  wavefront(4, 1000, 1000);
+}
+// ----------------------------------------------------------------------------
+// Executor::parallel_for and Executor::parallel_reduce
+// ----------------------------------------------------------------------------
+
+void executor_parallel_for(unsigned W) {
+
+  tf::Executor executor(W);
+
+  for(size_t n : {0, 1, 2, 3, 7, 16, 17, 100, 1000, 12345}) {
+    for(size_t c : {0, 1, 3, 100}) {
+
+      // indices
+      std::vector<int> vec(n, 0);
+      executor.parallel_for(0, static_cast<int>(n), [&](int i){ vec[i]++; }, c);
+      REQUIRE(std::count(vec.begin(), vec.end(), 1) == n);
+
+      // empty and reversed index ranges
+      executor.parallel_for(size_t{5}, size_t{5}, [&](size_t i){ vec[i]++; }, c);
+      executor.parallel_for(5, 2, [&](int i){ vec[i]++; }, c);
+      REQUIRE(std::count(vec.begin(), vec.end(), 1) == n);
+
+      // random-access iterators
+      executor.parallel_for(vec.begin(), vec.end(), [](int& i){ i++; }, c);
+      REQUIRE(std::count(vec.begin(), vec.end(), 2) == n);
+
+      // forward iterators
+      std::list<int> list(n, 0);
+      executor.parallel_for(list.begin(), list.end(), [](int& i){ i++; }, c);
+      REQUIRE(std::count(list.begin(), list.end(), 1) == n);
+
+      // reduction
+      std::iota(vec.begin(), vec.end(), 0);
+      std::iota(list.begin(), list.end(), 0);
+      long sum = static_cast<long>(n*(n-1)/2) + 10;
+      REQUIRE(executor.parallel_reduce(vec.begin(), vec.end(), 10L, 
+        [](long a, long b){ return a + b; }, c
+      ) == sum);
+      REQUIRE(executor.parallel_reduce(list.begin(), list.end(), 10L, 
+        [](long a, long b){ return a + b; }, c
+      ) == sum);
+    }
+  }
+}
+
+TEST_CASE("Executor.parallel_for.1thread" * doctest::timeout(300)) {
+  executor_parallel_for(1);
+}
+
+TEST_CASE("Executor.parallel_for.2threads" * doctest::timeout(300)) {
+  executor_parallel_for(2);
+}
+
+TEST_CASE("Executor.parallel_for.3threads" * doctest::timeout(300)) {
+  executor_parallel_for(3);
+}
+
+TEST_CASE("Executor.parallel_for.4threads" * doctest::timeout(300)) {
+  executor_parallel_for(4);
+}
+
+// calls parallel_for from tasks, asynchronous tasks, and parallel_for itself
+void nested_executor_parallel_for(unsigned W) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  const size_t N = 1000;
+
+  std::atomic<size_t> counter {0};
+
+  auto loop = [&] () {
+    executor.parallel_for(size_t{0}, N, [&](size_t){ counter++; });
+  };
+
+  for(int i=0; i<8; i++) {
+    taskflow.emplace(loop);
+  }
+  executor.run(taskflow).wait();
+  REQUIRE(counter == 8*N);
+
+  counter = 0;
+  for(int i=0; i<8; i++) {
+    executor.silent_async(loop);
+  }
+  executor.wait_for_all();
+  REQUIRE(counter == 8*N);
+
+  counter = 0;
+  executor.parallel_for(0, 8, [&](int){ loop(); });
+  REQUIRE(counter == 8*N);
+
+  // concurrent callers outside the executor
+  counter = 0;
+  std::vector<std::thread> threads;
+  for(int i=0; i<4; i++) {
+    threads.emplace_back(loop);
+  }
+  for(auto& thread : threads) {
+    thread.join();
+  }
+  REQUIRE(counter == 4*N);
+}
+
+TEST_CASE("Executor.parallel_for.Nested.1thread" * doctest::timeout(300)) {
+  nested_executor_parallel_for(1);
+}
+
+TEST_CASE("Executor.parallel_for.Nested.2threads" * doctest::timeout(300)) {
+  nested_executor_parallel_for(2);
+}
+
+TEST_CASE("Executor.parallel_for.Nested.4threads" * doctest::timeout(300)) {
+  nested_executor_parallel_for(4);
+}
+
+// the caller does not wait for helpers that busy workers have not started
+TEST_CASE("Executor.parallel_for.BusyWorkers" * doctest::timeout(300)) {
+
+  tf::Executor executor(2);
+
+  std::atomic<bool> done {false};
+  std::atomic<size_t> counter {0};
+
+  for(int i=0; i<2; i++) {
+    executor.silent_async([&](){ 
+      while(!done) std::this_thread::yield(); 
+    });
+  }
+
+  executor.parallel_for(0, 16, [&](int){ counter++; }, 1);
+  REQUIRE(counter == 16);
+  
+  std::vector<int> vec(16);
+  std::iota(vec.begin(), vec.end(), 0);
+  REQUIRE(executor.parallel_reduce(
+    vec.begin(), vec.end(), 0, std::plus<int>{}, 1
+  ) == 120);
+
+  done = true;
+  executor.wait_for_all();
+}
+
+// threads that cannot run tasks as the caller block until the helpers finish
+TEST_CASE("Executor.parallel_for.Callers" * doctest::timeout(300)) {
+
+  tf::Executor executor(2);
+
+  std::atomic<size_t> counter {0};
+
+  auto loop = [&] () {
+    for(int r=0; r<100; r++) {
+      executor.parallel_for(0, 100, [&](int){ counter++; }, 1);
+    }
+  };
+
+  // only one of the threads can be the caller at a time
+  std::vector<std::thread> threads;
+  for(int i=0; i<4; i++) {
+    threads.emplace_back(loop);
+  }
+  for(auto& t : threads) {
+    t.join();
+  }
+  REQUIRE(counter == 4*100*100);
+
+  // an observer keeps every thread from running tasks as the caller
+  auto observer = executor.make_observer<tf::ChromeObserver>();
+  loop();
+  REQUIRE(counter == 5*100*100);
+  executor.remove_observer(observer);
+}
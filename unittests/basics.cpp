@@ -5,6 +5,7 @@
 #include <utility>
 #include <chrono>
 #include <limits.h>
+#include <numeric>
 
 // --------------------------------------------------------
 // Testcase: Type
@@ -480,6 +481,683 @@ TEST_CASE("Hash" * doctest::timeout(300)) {
   REQUIRE(hash(t1) == hash(t2));
 }
 
+// --------------------------------------------------------
+// Testcase: Optimize
+// --------------------------------------------------------
+
+// reachability between all pairs of tasks
+std::vector<std::vector<bool>> reachability(const std::vector<tf::Task>& tasks) {
+
+  std::unordered_map<tf::Task, size_t> index;
+  for(size_t i=0; i<tasks.size(); i++) {
+    index[tasks[i]] = i;
+  }
+
+  std::vector<std::vector<bool>> R(tasks.size(), std::vector<bool>(tasks.size()));
+
+  for(size_t i=0; i<tasks.size(); i++) {
+    std::vector<tf::Task> stack {tasks[i]};
+    while(!stack.empty()) {
+      auto t = stack.back();
+      stack.pop_back();
+      t.for_each_successor([&](tf::Task s){
+        if(!R[i][index[s]]) {
+          R[i][index[s]] = true;
+          stack.push_back(s);
+        }
+      });
+    }
+  }
+
+  return R;
+}
+
+TEST_CASE("Optimize" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  
+  SUBCASE("Redundant") {
+    tf::Taskflow taskflow;
+    std::vector<int> order;
+    auto [A, B, C, D] = taskflow.emplace(
+      [&](){ order.push_back(0); }, 
+      [&](){ order.push_back(1); }, 
+      [&](){ order.push_back(2); }, 
+      [&](){ order.push_back(3); }
+    );
+    A.precede(B, C, D);
+    B.precede(C, D);
+    C.precede(D);
+    B.precede(C);
+
+    REQUIRE(taskflow.optimize() == 4);
+    REQUIRE(A.num_successors() == 1);
+    REQUIRE(B.num_successors() == 1);
+    REQUIRE(C.num_dependents() == 1);
+    REQUIRE(D.num_dependents() == 1);
+    REQUIRE(taskflow.optimize() == 0);
+
+    executor.run(taskflow).wait();
+    REQUIRE(order == std::vector<int>{0, 1, 2, 3});
+  }
+
+  SUBCASE("Condition") {
+    tf::Taskflow taskflow;
+    auto [A, B, C, D] = taskflow.emplace(
+      [](){}, [](){}, [](){ return 0; }, [](){}
+    );
+    // B can also run from the condition task C without A, so A->D is needed
+    A.precede(B, D);
+    B.precede(C, D);
+    C.precede(B, D, D);
+
+    REQUIRE(taskflow.optimize() == 0);
+    REQUIRE(A.num_successors() == 2);
+    REQUIRE(B.num_successors() == 2);
+    REQUIRE(C.num_successors() == 3);
+  }
+
+  SUBCASE("RandomDAG") {
+    
+    const size_t N = 200;
+
+    std::mt19937 rng(0);
+    std::vector<std::atomic<size_t>> stamps(N);
+    std::atomic<size_t> clock {0};
+
+    tf::Taskflow taskflow;
+    std::vector<tf::Task> tasks;
+    for(size_t i=0; i<N; i++) {
+      tasks.push_back(taskflow.emplace([&, i](){ stamps[i] = ++clock; }));
+    }
+
+    size_t num_edges = 0;
+    for(size_t i=0; i<N; i++) {
+      for(size_t j=i+1; j<N; j++) {
+        if(rng() % 8 == 0) {
+          tasks[i].precede(tasks[j]);
+          num_edges++;
+        }
+      }
+    }
+
+    auto R = reachability(tasks);
+    
+    auto removed = taskflow.optimize();
+    
+    REQUIRE(removed > 0);
+    REQUIRE(reachability(tasks) == R);
+    REQUIRE(taskflow.optimize() == 0);
+
+    size_t num_remaining = 0;
+    for(auto t : tasks) {
+      num_remaining += t.num_successors();
+    }
+    REQUIRE(num_remaining + removed == num_edges);
+    
+    executor.run(taskflow).wait();
+
+    for(size_t i=0; i<N; i++) {
+      for(size_t j=0; j<N; j++) {
+        if(R[i][j]) {
+          REQUIRE(stamps[i] < stamps[j]);
+        }
+      }
+    }
+  }
+}
+
+// --------------------------------------------------------
+// Testcase: Fuse
+// --------------------------------------------------------
+
+// records the names of the observed tasks
+struct NameObserver : public tf::ObserverInterface {
+  
+  std::mutex mutex;
+  std::vector<std::string> entries;
+  std::vector<std::string> exits;
+
+  void set_up(size_t) override {}
+
+  void on_entry(tf::WorkerView, tf::TaskView tv) override {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.push_back(tv.name());
+  }
+
+  void on_exit(tf::WorkerView, tf::TaskView tv) override {
+    std::lock_guard<std::mutex> lock(mutex);
+    exits.push_back(tv.name());
+  }
+};
+
+TEST_CASE("Fuse" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  
+  SUBCASE("Chain") {
+    tf::Taskflow taskflow;
+    std::vector<size_t> order;
+    std::vector<tf::Task> tasks;
+    for(size_t i=0; i<100; i++) {
+      tasks.push_back(
+        taskflow.emplace([&, i](){ order.push_back(i); }).name(std::to_string(i))
+      );
+    }
+    taskflow.linearize(tasks);
+
+    REQUIRE(taskflow.fuse() == 99);
+    REQUIRE(taskflow.num_tasks() == 1);
+    REQUIRE(taskflow.fuse() == 0);
+
+    auto observer = executor.make_observer<NameObserver>();
+
+    executor.run_n(taskflow, 2).wait();
+
+    REQUIRE(order.size() == 200);
+    for(size_t i=0; i<200; i++) {
+      REQUIRE(order[i] == i % 100);
+    }
+
+    REQUIRE(observer->entries.size() == 200);
+    REQUIRE(observer->entries == observer->exits);
+    for(size_t i=0; i<200; i++) {
+      REQUIRE(observer->entries[i] == std::to_string(i % 100));
+    }
+  }
+
+  SUBCASE("Work") {
+    tf::Taskflow taskflow;
+    std::vector<int> order;
+    auto A = taskflow.emplace([&](){ order.push_back(0); });
+    auto B = taskflow.emplace([&](){ order.push_back(1); });
+    A.precede(B);
+
+    REQUIRE(taskflow.fuse() == 1);
+
+    // re-assigning the head keeps the fused task
+    A.work([&](){ order.push_back(2); });
+    executor.run(taskflow).wait();
+    REQUIRE(order == std::vector<int>{2, 1});
+
+    REQUIRE_THROWS(A.work([](tf::Subflow&){}));
+    REQUIRE_THROWS(A.work([](){ return 0; }));
+    REQUIRE(A.type() == tf::TaskType::STATIC);
+
+    order.clear();
+    executor.run(taskflow).wait();
+    REQUIRE(order == std::vector<int>{2, 1});
+  }
+
+  SUBCASE("Branches") {
+    // A -> B -> C -> D -> E -> F
+    //      B -> X -> Y -> E 
+    //                     E -> S (semaphore) -> T
+    tf::Taskflow taskflow;
+    tf::Semaphore semaphore(1);
+    std::atomic<int> clock {0};
+    int A, B, C, D, E, F, X, Y, S, T;
+    auto [a, b, c, d, e, f, x, y, s, t] = taskflow.emplace(
+      [&](){ A = clock++; }, [&](){ B = clock++; }, [&](){ C = clock++; },
+      [&](){ D = clock++; }, [&](){ E = clock++; }, [&](){ F = clock++; },
+      [&](){ X = clock++; }, [&](){ Y = clock++; }, [&](){ S = clock++; },
+      [&](){ T = clock++; }
+    );
+    a.precede(b);
+    b.precede(c, x);
+    c.precede(d);
+    d.precede(e);
+    x.precede(y);
+    y.precede(e);
+    e.precede(f, s);
+    s.precede(t);
+    s.acquire(semaphore);
+    s.release(semaphore);
+
+    // fuses B into A, D into C, and Y into X
+    REQUIRE(taskflow.fuse() == 3);
+    REQUIRE(taskflow.num_tasks() == 7);
+    REQUIRE(a.num_successors() == 2);
+    REQUIRE(c.num_successors() == 1);
+    REQUIRE(x.num_successors() == 1);
+    REQUIRE(e.num_dependents() == 2);
+    REQUIRE(e.num_successors() == 2);
+
+    executor.run(taskflow).wait();
+
+    REQUIRE(clock == 10);
+    REQUIRE(A < B);
+    REQUIRE(B < C);
+    REQUIRE(C < D);
+    REQUIRE(B < X);
+    REQUIRE(X < Y);
+    REQUIRE(D < E);
+    REQUIRE(Y < E);
+    REQUIRE(E < F);
+    REQUIRE(E < S);
+    REQUIRE(S < T);
+  }
+
+  SUBCASE("Condition") {
+    tf::Taskflow taskflow;
+    int i = 0, j = 0;
+    auto [init, body, cond, done] = taskflow.emplace(
+      [&](){ i = 0; }, 
+      [&](){ ++i; }, 
+      [&](){ return i < 5 ? 0 : 1; }, 
+      [&](){ j = i; }
+    );
+    init.precede(body);
+    body.precede(cond);
+    cond.precede(body, done);
+
+    // body has a weak dependent, so nothing can be fused
+    REQUIRE(taskflow.fuse() == 0);
+    executor.run(taskflow).wait();
+    REQUIRE(j == 5);
+  }
+}
+
+// --------------------------------------------------------
+// Testcase: CriticalPath
+// --------------------------------------------------------
+TEST_CASE("CriticalPath" * doctest::timeout(300)) {
+
+  // with one worker, tasks run in the order the executor prioritizes them
+  tf::Executor executor(1);
+  tf::Taskflow taskflow;
+
+  std::string order;
+
+  REQUIRE(taskflow.critical_path_scheduling() == false);
+  taskflow.critical_path_scheduling(true);
+  REQUIRE(taskflow.critical_path_scheduling() == true);
+
+  auto [A, B, C, D, E] = taskflow.emplace(
+    [&](){ order += 'A'; }, [&](){ order += 'B'; }, [&](){ order += 'C'; },
+    [&](){ order += 'D'; }, [&](){ order += 'E'; }
+  );
+  
+  REQUIRE(A.weight() == 1);
+
+  // C heads the longest path to a sink
+  A.precede(C, B);
+  C.precede(D);
+  D.precede(E);
+  
+  executor.run(taskflow).wait();
+  REQUIRE(order == "ACDEB");
+
+  // B outweighs the path of C
+  order.clear();
+  B.weight(10);
+  REQUIRE(B.weight() == 10);
+  executor.run(taskflow).wait();
+  REQUIRE(order == "ABCDE");
+
+  // ties keep the order of the last successor first
+  order.clear();
+  B.weight(3);
+  executor.run(taskflow).wait();
+  REQUIRE(order == "ABCDE");
+
+  // the last ready successor goes first without critical-path scheduling
+  order.clear();
+  B.weight(1);
+  taskflow.critical_path_scheduling(false);
+  executor.run(taskflow).wait();
+  REQUIRE(order == "ABCDE");
+  taskflow.critical_path_scheduling(true);
+
+  // weights from profiled durations
+  auto observer = executor.make_observer<tf::TFProfObserver>();
+  taskflow.clear();
+  order.clear();
+  auto [F, G, H] = taskflow.emplace(
+    [&](){ order += 'F'; }, 
+    [&](){ order += 'G'; }, 
+    [&](){ 
+      order += 'H'; 
+      std::this_thread::sleep_for(std::chrono::milliseconds(10)); 
+    }
+  );
+  F.name("F");
+  G.name("G");
+  H.name("H");
+  F.precede(H, G);
+  executor.run(taskflow).wait();
+  REQUIRE(order == "FGH");
+  
+  REQUIRE(observer->weigh(taskflow) == 3);
+  REQUIRE(H.weight() >= 10000);
+  order.clear();
+  executor.run(taskflow).wait();
+  REQUIRE(order == "FHG");
+}
+
+// --------------------------------------------------------
+// Testcase: ConcurrentRuns
+// --------------------------------------------------------
+TEST_CASE("ConcurrentRuns" * doctest::timeout(300)) {
+
+  const size_t W = 4;
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  REQUIRE(taskflow.max_concurrent_runs() == 1);
+  REQUIRE_THROWS(taskflow.max_concurrent_runs(0));
+  taskflow.max_concurrent_runs(W);
+  REQUIRE(taskflow.max_concurrent_runs() == W);
+
+  std::atomic<size_t> arrived {0};
+  std::atomic<size_t> counter {0};
+  
+  SUBCASE("Overlap") {
+    // every run waits in its first task until all runs have started
+    auto A = taskflow.emplace([&](){ 
+      arrived.fetch_add(1);
+      while(arrived.load() < W) {
+        std::this_thread::yield();
+      }
+    });
+    auto B = taskflow.emplace([&](){ counter.fetch_add(1); });
+    A.precede(B);
+
+    std::vector<tf::Future<void>> futures;
+    for(size_t i=0; i<W; i++) {
+      futures.push_back(executor.run(taskflow));
+    }
+    for(auto& fu : futures) {
+      fu.get();
+    }
+    REQUIRE(counter == W);
+  }
+
+  SUBCASE("MixedTasks") {
+    // static, dynamic, condition, and detached tasks with queued runs 
+    auto init = taskflow.emplace([](){}).name("init");
+    auto cond = taskflow.emplace([](){ return 1; }).name("cond");
+    auto skip = taskflow.emplace([&](){ counter.fetch_add(100); });
+    auto body = taskflow.emplace([&](tf::Subflow& sf){
+      sf.emplace([&](){ counter.fetch_add(1); });
+      sf.emplace([&](){ counter.fetch_add(1); });
+    });
+    auto detached = taskflow.emplace([&](tf::Subflow& sf){
+      sf.emplace([&](){ counter.fetch_add(1); });
+      sf.detach();
+    });
+    auto done = taskflow.emplace([&](){ counter.fetch_add(1); });
+    init.precede(cond);
+    cond.precede(skip, body);
+    body.precede(detached);
+    detached.precede(done);
+    
+    const size_t N = 100;
+    for(size_t i=0; i<N; i++) {
+      executor.run(taskflow);
+    }
+    executor.run_n(taskflow, N);
+    executor.wait_for_all();
+    
+    REQUIRE(counter == 2*N*4);
+  }
+
+  SUBCASE("Modified") {
+    // copies of the graph are reused until the taskflow becomes idle
+    taskflow.emplace([&](){ counter.fetch_add(1); });
+    for(size_t n=1; n<=10; n++) {
+      counter = 0;
+      for(size_t i=0; i<100; i++) {
+        executor.run(taskflow);
+      }
+      executor.wait_for_all();
+      REQUIRE(counter == 100*n);
+      taskflow.emplace([&](){ counter.fetch_add(1); });
+    }
+  }
+
+  SUBCASE("Module") {
+    // taskflows with module tasks cannot run concurrently
+    tf::Taskflow module;
+    module.emplace([&](){ counter.fetch_add(1); });
+    taskflow.composed_of(module);
+    REQUIRE_THROWS(executor.run(taskflow));
+    REQUIRE(executor.num_topologies() == 0);
+    taskflow.max_concurrent_runs(1);
+    for(size_t i=0; i<100; i++) {
+      executor.run(taskflow);
+    }
+    executor.wait_for_all();
+    REQUIRE(counter == 100);
+  }
+}
+
+// --------------------------------------------------------
+// Testcase: OverlappingIterations
+// --------------------------------------------------------
+TEST_CASE("OverlappingIterations" * doctest::timeout(300)) {
+
+  const size_t K = 4;
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  REQUIRE(taskflow.max_overlapping_iterations() == 1);
+  REQUIRE(taskflow.ordered_iterations() == false);
+  REQUIRE_THROWS(taskflow.max_overlapping_iterations(0));
+  taskflow.max_overlapping_iterations(K);
+  REQUIRE(taskflow.max_overlapping_iterations() == K);
+
+  std::atomic<size_t> counter {0};
+  
+  SUBCASE("Overlap") {
+    // the sink of the first iteration waits for the source of the second
+    auto S = taskflow.emplace([&](){ counter.fetch_add(1); });
+    auto T = taskflow.emplace([&](){ 
+      while(counter.load() < 2) {
+        std::this_thread::yield();
+      }
+    });
+    S.precede(T);
+    executor.run_n(taskflow, 2).wait();
+    REQUIRE(counter == 2);
+  }
+
+  SUBCASE("Unordered") {
+    // dynamic and detached tasks with every iteration count
+    auto A = taskflow.emplace([&](){ counter.fetch_add(1); });
+    auto B = taskflow.emplace([&](tf::Subflow& sf){ 
+      sf.emplace([&](){ counter.fetch_add(1); });
+      sf.emplace([&](){ counter.fetch_add(1); });
+    });
+    auto C = taskflow.emplace([&](tf::Subflow& sf){ 
+      sf.emplace([&](){ counter.fetch_add(1); });
+      sf.detach();
+    });
+    A.precede(B, C);
+    for(size_t n=0; n<=10; n++) {
+      counter = 0;
+      executor.run_n(taskflow, n).wait();
+      REQUIRE(counter == 4*n);
+    }
+    counter = 0;
+    executor.run_until(taskflow, [i=0] () mutable { return ++i > 50; }).wait();
+    REQUIRE(counter == 4*50);
+  }
+
+  SUBCASE("Ordered") {
+    // the k-th runs of A and B belong to the same iteration k
+    taskflow.ordered_iterations(true);
+    REQUIRE(taskflow.ordered_iterations() == true);
+
+    const size_t N = 1000;
+    std::vector<size_t> buffer(K);
+    std::atomic<int> in_A {0}, in_B {0};
+    size_t a = 0, b = 0;
+
+    auto A = taskflow.emplace([&](){ 
+      REQUIRE(in_A.fetch_add(1) == 0);
+      std::this_thread::yield();
+      buffer[a % K] = a;
+      a++;
+      in_A.fetch_sub(1);
+    });
+    auto B = taskflow.emplace([&](){ 
+      REQUIRE(in_B.fetch_add(1) == 0);
+      std::this_thread::yield();
+      REQUIRE(buffer[b % K] == b);
+      b++;
+      in_B.fetch_sub(1);
+    });
+    auto C = taskflow.emplace([&](){ counter.fetch_add(1); });
+    A.precede(B, C);
+
+    executor.run_n(taskflow, N).wait();
+    REQUIRE(a == N);
+    REQUIRE(b == N);
+    REQUIRE(counter == N);
+
+    // condition tasks run the iterations one after another
+    auto cond = taskflow.emplace([](){ return 0; });
+    cond.precede(A);
+    executor.run_n(taskflow, N).wait();
+    REQUIRE(a == 2*N);
+    REQUIRE(b == 2*N);
+  }
+
+  SUBCASE("Cancel") {
+    // tasks that run before the cancellation takes effect stay in order,
+    // and later runs reuse the copies of the graph
+    taskflow.ordered_iterations(true);
+    std::vector<size_t> buffer(K);
+    size_t a = 0, b = 0;
+    auto A = taskflow.emplace([&](){ 
+      counter.fetch_add(1); 
+      buffer[a % K] = a;
+      a++;
+    });
+    auto B = taskflow.emplace([&](){ 
+      std::this_thread::sleep_for(std::chrono::microseconds(10)); 
+      REQUIRE(buffer[b % K] == b);
+      b++;
+    });
+    A.precede(B);
+    auto fu = executor.run_n(taskflow, 100000);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    fu.cancel();
+    fu.get();
+    REQUIRE(counter < 100000);
+    REQUIRE(b <= a);
+    
+    counter = 0;
+    a = b = 0;
+    executor.run_n(taskflow, 100).wait();
+    REQUIRE(counter == 100);
+    REQUIRE(b == 100);
+    
+    // unordered concurrent runs reuse the copies without the tokens
+    taskflow.ordered_iterations(false);
+    taskflow.max_concurrent_runs(2);
+    A.work([&](){ counter.fetch_add(1); });
+    B.work([](){});
+    counter = 0;
+    executor.run_n(taskflow, 100);
+    executor.run_n(taskflow, 100);
+    executor.wait_for_all();
+    REQUIRE(counter == 200);
+  }
+}
+
+// --------------------------------------------------------
+// Testcase: RunAndWait
+// --------------------------------------------------------
+TEST_CASE("RunAndWait" * doctest::timeout(300)) {
+
+  tf::Executor executor(1);
+  tf::Taskflow taskflow;
+
+  std::atomic<bool> flag {false};
+  std::atomic<size_t> counter {0};
+  
+  SUBCASE("Caller") {
+    // the only worker and the caller each take one of the two tasks
+    taskflow.emplace(
+      [&](){ while(!flag) std::this_thread::yield(); },
+      [&](){ flag = true; }
+    );
+    for(size_t i=0; i<10; i++) {
+      flag = false;
+      executor.run_and_wait(taskflow);
+      REQUIRE(flag == true);
+    }
+  }
+
+  SUBCASE("Worker") {
+    // the only worker runs the inner taskflow instead of blocking
+    tf::Taskflow inner;
+    inner.emplace([&](){ counter++; });
+    taskflow.emplace([&](){ 
+      executor.run_and_wait(inner); 
+      counter++;
+    });
+    executor.run_and_wait(taskflow);
+    REQUIRE(counter == 2);
+  }
+
+  SUBCASE("Subflow") {
+    // a subflow joined on the caller runs its children on the caller 
+    // or the worker
+    for(size_t i=0; i<10; i++) {
+      taskflow.emplace([&](tf::Subflow& sf){
+        for(size_t j=0; j<10; j++) {
+          sf.emplace([&](){ counter++; });
+        }
+        sf.join();
+        REQUIRE(executor.this_worker_id() <= 0);
+        counter++;
+      });
+    }
+    std::vector<int> data(100000);
+    std::iota(data.rbegin(), data.rend(), 0);
+    taskflow.sort(data.begin(), data.end());
+    for(size_t i=0; i<10; i++) {
+      executor.run_and_wait(taskflow);
+    }
+    REQUIRE(counter == 1100);
+    REQUIRE(std::is_sorted(data.begin(), data.end()));
+  }
+
+  SUBCASE("Threads") {
+    // calling threads do not run tasks while observers are attached
+    auto observer = executor.make_observer<tf::TFProfObserver>();
+    for(size_t i=0; i<100; i++) {
+      taskflow.emplace([&](){ counter++; });
+    }
+    std::vector<std::thread> threads;
+    for(size_t t=0; t<4; t++) {
+      threads.emplace_back([&](){ 
+        for(size_t i=0; i<10; i++) {
+          executor.run_and_wait(taskflow);
+        }
+      });
+    }
+    for(auto& thread : threads) {
+      thread.join();
+    }
+    REQUIRE(counter == 4000);
+
+    // all tasks are recorded on the workers
+    auto dump = observer->dump();
+    size_t num_spans = 0;
+    for(auto p = dump.find("span"); p != std::string::npos; 
+        p = dump.find("span", p + 1)) {
+      num_spans++;
+    }
+    REQUIRE(num_spans == 4000);
+  }
+}
+
 // --------------------------------------------------------
 // Testcase: SequentialRuns
 // --------------------------------------------------------
@@ -2061,6 +2739,182 @@ TEST_CASE("Observer.4threads" * doctest::timeout(300)) {
   observer(4);
 }
 
+// --------------------------------------------------------
+// Testcase: ExtendedObserver
+// -------------------------------------------------------- 
+
+struct EventObserver : public tf::ObserverInterface {
+
+  size_t num_workers {0};
+  std::atomic<size_t> num_steals {0};
+  std::atomic<size_t> num_failed_steals {0};
+  std::atomic<size_t> num_parks {0};
+  std::atomic<size_t> num_unparks {0};
+  std::atomic<size_t> num_ready {0};
+  std::atomic<size_t> num_starts {0};
+  std::atomic<size_t> num_ends {0};
+  std::atomic<bool> valid_victims {true};
+
+  void set_up(size_t W) override { num_workers = W; }
+  void on_entry(tf::WorkerView, tf::TaskView) override {}
+  void on_exit(tf::WorkerView, tf::TaskView) override {}
+
+  void on_steal(tf::WorkerView w, size_t victim, bool success) override {
+    if(victim > num_workers || victim == w.id()) {
+      valid_victims = false;
+    }
+    (success ? num_steals : num_failed_steals)++;
+  }
+  void on_park(tf::WorkerView) override { num_parks++; }
+  void on_unpark(tf::WorkerView) override { num_unparks++; }
+  void on_ready(tf::TaskView) override { num_ready++; }
+  void on_topology_start(const tf::Taskflow&) override { num_starts++; }
+  void on_topology_end(const tf::Taskflow&) override { num_ends++; }
+};
+
+// observes only the start and end of topologies
+struct TopologyObserver : public tf::ObserverInterface {
+  std::vector<std::string> events;
+  void set_up(size_t) override {}
+  void on_entry(tf::WorkerView, tf::TaskView) override {}
+  void on_exit(tf::WorkerView, tf::TaskView) override {}
+  void on_topology_start(const tf::Taskflow& f) override { 
+    events.push_back("start " + f.name()); 
+  }
+  void on_topology_end(const tf::Taskflow& f) override { 
+    events.push_back("end " + f.name()); 
+  }
+};
+
+void extended_observer(unsigned W) {
+
+  tf::Executor executor(W);
+
+  auto observer = executor.make_observer<EventObserver>();
+  auto topology = executor.make_observer<TopologyObserver>();
+
+  tf::Taskflow taskflow("T");
+  std::vector<tf::Task> tasks;
+  for(int i=0; i<100; i++) {
+    tasks.push_back(taskflow.emplace([](){}));
+  }
+  for(int i=1; i<100; i++) {
+    tasks[0].precede(tasks[i]);
+  }
+  
+  executor.run_n(taskflow, 3).wait();
+  executor.run(taskflow).wait();
+
+  // each task becomes ready once per run
+  REQUIRE(observer->num_ready == 4*100);
+  REQUIRE(observer->num_starts == 2);
+  REQUIRE(observer->num_ends == 2);
+  REQUIRE(observer->num_steals >= 2);
+  REQUIRE(observer->valid_victims);
+  REQUIRE(topology->events == std::vector<std::string>{
+    "start T", "end T", "start T", "end T"
+  });
+
+  // workers park after the runs and wake up for the next task
+  while(observer->num_parks < W) {
+    std::this_thread::yield();
+  }
+  executor.silent_async([](){});
+  executor.wait_for_all();
+  REQUIRE(observer->num_unparks >= 1);
+  REQUIRE(observer->num_ready == 4*100 + 1);
+  
+  // a removed observer sees no more events
+  executor.remove_observer(observer);
+  executor.run(taskflow).wait();
+  REQUIRE(observer->num_ready == 4*100 + 1);
+  REQUIRE(topology->events.size() == 6);
+}
+
+TEST_CASE("ExtendedObserver.1thread" * doctest::timeout(300)) {
+  extended_observer(1);
+}
+
+TEST_CASE("ExtendedObserver.2threads" * doctest::timeout(300)) {
+  extended_observer(2);
+}
+
+TEST_CASE("ExtendedObserver.4threads" * doctest::timeout(300)) {
+  extended_observer(4);
+}
+
+// --------------------------------------------------------
+// Testcase: Observer.Concurrent
+// -------------------------------------------------------- 
+
+TEST_CASE("Observer.Concurrent" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+  
+  std::atomic<size_t> counter {0};
+  for(int i=0; i<1000; i++) {
+    taskflow.emplace([&](){ counter.fetch_add(1, std::memory_order_relaxed); });
+  }
+
+  REQUIRE(executor.num_observers() == 0);
+  
+  auto future = executor.run_n(taskflow, 100);
+
+  // observers come and go while the workers run tasks
+  std::vector<std::shared_ptr<EventObserver>> observers;
+  for(int i=0; i<100; i++) {
+    observers.push_back(executor.make_observer<EventObserver>());
+    if(i % 2) {
+      executor.remove_observer(observers[i-1]);
+    }
+  }
+  REQUIRE(executor.num_observers() == 50);
+
+  future.wait();
+  REQUIRE(counter == 100*1000);
+
+  for(auto& o : observers) {
+    executor.remove_observer(o);
+  }
+  REQUIRE(executor.num_observers() == 0);
+
+  // removing an observer twice does nothing
+  executor.remove_observer(observers[0]);
+  REQUIRE(executor.num_observers() == 0);
+}
+
+// --------------------------------------------------------
+// Testcase: Observer.Release
+// -------------------------------------------------------- 
+
+TEST_CASE("Observer.Release" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  for(int i=0; i<100; i++) {
+    taskflow.emplace([](){});
+  }
+
+  // the executor drops a removed observer once no worker uses it
+  for(int i=0; i<10; i++) {
+    auto observer = executor.make_observer<tf::ChromeObserver>();
+    executor.run(taskflow).wait();
+    REQUIRE(observer.use_count() > 1);
+    executor.remove_observer(observer);
+    REQUIRE(observer.use_count() == 1);
+    REQUIRE(observer->num_tasks() == 100);
+  }
+
+  // the same holds when a task removes the observer
+  auto observer = executor.make_observer<tf::ChromeObserver>();
+  executor.silent_async([&](){ executor.remove_observer(observer); });
+  executor.wait_for_all();
+  REQUIRE(executor.num_observers() == 0);
+  REQUIRE(observer.use_count() == 1);
+}
+
 // --------------------------------------------------------
 // Testcase: Conditional Tasking
 // -------------------------------------------------------- 
@@ -2885,6 +3739,157 @@ TEST_CASE("NestedAsync.16threads" * doctest::timeout(300)) {
   nested_async(16);  
 }
 
+// --------------------------------------------------------
+// Testcase: SilentAsyncBulk
+// --------------------------------------------------------
+void silent_async_bulk(unsigned W) {
+
+  tf::Executor executor(W);
+
+  const size_t N = 10000;
+
+  std::vector<std::atomic<int>> counts(N);
+  
+  // indices
+  for(size_t n : {size_t{0}, size_t{1}, size_t{17}, N}) {
+    executor.silent_async_bulk(n, [&](size_t i){ counts[i]++; });
+  }
+  executor.wait_for_all();
+  
+  for(size_t i=0; i<N; i++) {
+    REQUIRE(counts[i] == (i == 0 ? 3 : (i < 17 ? 2 : 1)));
+    counts[i] = 0;
+  }
+
+  // ranges and submissions from workers
+  std::vector<size_t> vector(N);
+  std::list<size_t> list(N);
+  std::iota(vector.begin(), vector.end(), 0);
+  std::iota(list.begin(), list.end(), 0);
+  
+  executor.silent_async([&](){
+    executor.silent_async_bulk(vector.begin(), vector.end(), [&](size_t i){
+      counts[i]++;
+    });
+  });
+  executor.silent_async_bulk(list.begin(), list.end(), [&](size_t i){
+    counts[i]++;
+  });
+  executor.wait_for_all();
+
+  for(size_t i=0; i<N; i++) {
+    REQUIRE(counts[i] == 2);
+  }
+
+  // the shared callable is released after the last task
+  auto data = std::make_shared<int>(0);
+  executor.silent_async_bulk(N, [data](size_t){});
+  executor.wait_for_all();
+  REQUIRE(data.use_count() == 1);
+}
+
+TEST_CASE("SilentAsyncBulk.1thread" * doctest::timeout(300)) {
+  silent_async_bulk(1);
+}
+
+TEST_CASE("SilentAsyncBulk.2threads" * doctest::timeout(300)) {
+  silent_async_bulk(2);
+}
+
+TEST_CASE("SilentAsyncBulk.4threads" * doctest::timeout(300)) {
+  silent_async_bulk(4);
+}
+
+// --------------------------------------------------------
+// Testcase: TaskGroup
+// --------------------------------------------------------
+
+void task_group(unsigned W) {
+
+  tf::Executor executor(W);
+
+  const size_t N = 1000;
+
+  std::atomic<size_t> counter {0};
+
+  // wait from outside the executor and reuse the group
+  tf::TaskGroup group(executor);
+
+  for(int r=0; r<3; r++) {
+    for(size_t i=0; i<N; i++) {
+      group.async([&](){ counter.fetch_add(1, std::memory_order_relaxed); });
+    }
+    group.wait();
+    REQUIRE(group.num_pending() == 0);
+    REQUIRE(counter == (r+1)*N);
+  }
+
+  // nested groups waited for by workers
+  counter = 0;
+  for(size_t i=0; i<10; i++) {
+    group.async([&](){
+      tf::TaskGroup inner(executor);
+      for(size_t j=0; j<N; j++) {
+        inner.async([&](size_t k){ counter.fetch_add(k); }, size_t{1});
+      }
+      inner.wait();
+      REQUIRE(inner.num_pending() == 0);
+    });
+  }
+  group.wait();
+  REQUIRE(counter == 10*N);
+
+  // a group with pending tasks is one submission for wait_for_all
+  counter = 0;
+  for(size_t i=0; i<N; i++) {
+    group.async([&](){ counter.fetch_add(1, std::memory_order_relaxed); });
+  }
+  executor.wait_for_all();
+  REQUIRE(counter == N);
+  REQUIRE(executor.num_topologies() == 0);
+
+  // cancelled tasks do not run
+  std::atomic<bool> stop {false};
+  tf::TaskGroup cancelled(executor);
+  for(size_t i=0; i<W; i++) {
+    cancelled.async([&](){ 
+      while(!stop) std::this_thread::yield(); 
+    });
+  }
+  counter = 0;
+  for(size_t i=0; i<N; i++) {
+    cancelled.async([&](){ counter.fetch_add(1, std::memory_order_relaxed); });
+  }
+  cancelled.cancel();
+  REQUIRE(cancelled.is_cancelled());
+  stop = true;
+  cancelled.wait();
+  REQUIRE(counter < N);
+  REQUIRE(cancelled.num_pending() == 0);
+
+  // the destructor waits for the tasks
+  counter = 0;
+  {
+    tf::TaskGroup scoped(executor);
+    for(size_t i=0; i<N; i++) {
+      scoped.async([&](){ counter.fetch_add(1, std::memory_order_relaxed); });
+    }
+  }
+  REQUIRE(counter == N);
+}
+
+TEST_CASE("TaskGroup.1thread" * doctest::timeout(300)) {
+  task_group(1);
+}
+
+TEST_CASE("TaskGroup.2threads" * doctest::timeout(300)) {
+  task_group(2);
+}
+
+TEST_CASE("TaskGroup.4threads" * doctest::timeout(300)) {
+  task_group(4);
+}
+
 // --------------------------------------------------------
 // Testcase: MixedAsync
 // --------------------------------------------------------
@@ -3076,6 +4081,113 @@ TEST_CASE("NestedSubflowAsync.11threads") {
   nested_subflow_async(11);
 }
 
+// --------------------------------------------------------
+// Testcase: Runtime
+// --------------------------------------------------------
+
+void runtime(size_t W) {
+  
+  tf::Taskflow taskflow;
+  tf::Executor executor(W);
+
+  std::vector<std::atomic<int>> counters(20);
+  for(auto& c : counters) {
+    c = 0;
+  }
+
+  std::atomic<int> total {0};
+
+  auto A = taskflow.emplace([&](){ total++; });
+
+  auto R = taskflow.emplace([&](tf::Runtime& rt){
+    REQUIRE(&rt.executor() == &executor);
+    // co-runs of different sizes reuse the same helpers
+    for(size_t n : {0, 1, 20, 5, 17}) {
+      rt.corun_n(n, [&](size_t i){
+        REQUIRE(i < n);
+        counters[i]++;
+      });
+    }
+    total++;
+  });
+
+  auto B = taskflow.emplace([&](){ 
+    REQUIRE(total % 3 == 2);
+    total++; 
+  });
+
+  A.precede(R);
+  R.precede(B);
+
+  REQUIRE(R.type() == tf::TaskType::RUNTIME);
+
+  executor.run_n(taskflow, 10).wait();
+
+  REQUIRE(total == 30);
+  for(size_t i=0; i<counters.size(); i++) {
+    REQUIRE(counters[i] == 10*((i < 1) + (i < 20) + (i < 5) + (i < 17)));
+  }
+
+  // replacing the work recycles the helpers of the runtime task
+  R.work([&](){ total++; });
+  REQUIRE(R.type() == tf::TaskType::STATIC);
+  executor.run(taskflow).wait();
+  REQUIRE(total == 33);
+}
+
+TEST_CASE("Runtime.1thread") {
+  runtime(1);
+}
+
+TEST_CASE("Runtime.3threads") {
+  runtime(3);
+}
+
+TEST_CASE("Runtime.11threads") {
+  runtime(11);
+}
+
+// --------------------------------------------------------
+// Testcase: NestedRuntime
+// --------------------------------------------------------
+
+void nested_runtime(size_t W) {
+  
+  tf::Taskflow taskflow;
+  tf::Executor executor(W);
+
+  std::atomic<int> counter {0};
+
+  // runtime tasks running algorithms inside a subflow
+  taskflow.emplace([&](tf::Subflow& sf){
+    for(int i=0; i<4; i++) {
+      sf.emplace([&](tf::Runtime& rt){
+        rt.corun_n(8, [&](size_t){
+          counter.fetch_add(1, std::memory_order_relaxed);
+        });
+      });
+      sf.for_each_index(0, 100, 1, [&](int){
+        counter.fetch_add(1, std::memory_order_relaxed);
+      });
+    }
+  });
+
+  executor.run_n(taskflow, 5).wait();
+  REQUIRE(counter == 5*4*108);
+}
+
+TEST_CASE("NestedRuntime.1thread") {
+  nested_runtime(1);
+}
+
+TEST_CASE("NestedRuntime.3threads") {
+  nested_runtime(3);
+}
+
+TEST_CASE("NestedRuntime.11threads") {
+  nested_runtime(11);
+}
+
 // --------------------------------------------------------
 // Testcase: CriticalSection
 // --------------------------------------------------------
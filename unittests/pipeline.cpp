@@ -0,0 +1,244 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest.h>
+#include <taskflow/taskflow.hpp>
+
+// ----------------------------------------------------------------------------
+// Constructor
+// ----------------------------------------------------------------------------
+
+TEST_CASE("Pipeline.Constructor" * doctest::timeout(300)) {
+
+  tf::Pipeline pl(3,
+    tf::Pipe{tf::PipeType::SERIAL, [](tf::Pipeflow&){}},
+    tf::Pipe{tf::PipeType::PARALLEL, [](tf::Pipeflow&){}}
+  );
+
+  REQUIRE(pl.num_lines() == 3);
+  REQUIRE(pl.num_pipes() == 2);
+  REQUIRE(pl.num_tokens() == 0);
+
+  REQUIRE_THROWS(tf::Pipeline(3,
+    tf::Pipe{tf::PipeType::PARALLEL, [](tf::Pipeflow&){}}
+  ));
+
+  REQUIRE_THROWS(tf::Pipeline(0,
+    tf::Pipe{tf::PipeType::SERIAL, [](tf::Pipeflow&){}}
+  ));
+}
+
+// ----------------------------------------------------------------------------
+// Serial pipes
+// ----------------------------------------------------------------------------
+
+// every serial pipe must see the tokens in increasing order
+void serial_pipes(unsigned w, size_t L, size_t N) {
+
+  tf::Executor executor(w);
+  tf::Taskflow taskflow;
+
+  std::vector<std::vector<size_t>> seen(3);
+  std::vector<size_t> buffer(L);
+
+  tf::Pipeline pl(L,
+    tf::Pipe{tf::PipeType::SERIAL, [&](tf::Pipeflow& pf) {
+      if(pf.token() == N) {
+        pf.stop();
+        return;
+      }
+      REQUIRE(pf.line() == pf.token() % L);
+      buffer[pf.line()] = pf.token();
+      seen[0].push_back(pf.token());
+    }},
+    tf::Pipe{tf::PipeType::SERIAL, [&](tf::Pipeflow& pf) {
+      REQUIRE(buffer[pf.line()] == pf.token());
+      seen[1].push_back(pf.token());
+    }},
+    tf::Pipe{tf::PipeType::SERIAL, [&](tf::Pipeflow& pf) {
+      REQUIRE(buffer[pf.line()] == pf.token());
+      seen[2].push_back(pf.token());
+    }}
+  );
+
+  taskflow.pipeline(pl);
+
+  executor.run(taskflow).wait();
+
+  REQUIRE(pl.num_tokens() == N);
+
+  for(auto& s : seen) {
+    REQUIRE(s.size() == N);
+    for(size_t i=0; i<N; i++) {
+      REQUIRE(s[i] == i);
+    }
+  }
+
+  // run again continues the token numbering
+  for(auto& s : seen) {
+    s.clear();
+  }
+  N = 2*N;
+  executor.run(taskflow).wait();
+  REQUIRE(pl.num_tokens() == N);
+  for(auto& s : seen) {
+    REQUIRE(s.size() == N/2);
+    for(size_t i=0; i<N/2; i++) {
+      REQUIRE(s[i] == N/2 + i);
+    }
+  }
+
+  // reset restarts the token numbering
+  for(auto& s : seen) {
+    s.clear();
+  }
+  pl.reset();
+  executor.run(taskflow).wait();
+  REQUIRE(seen[2].size() == N);
+}
+
+TEST_CASE("Pipeline.Serial.1L.1W" * doctest::timeout(300)) {
+  serial_pipes(1, 1, 100);
+}
+
+TEST_CASE("Pipeline.Serial.3L.2W" * doctest::timeout(300)) {
+  serial_pipes(2, 3, 1000);
+}
+
+TEST_CASE("Pipeline.Serial.4L.4W" * doctest::timeout(300)) {
+  serial_pipes(4, 4, 1000);
+}
+
+TEST_CASE("Pipeline.Serial.8L.3W" * doctest::timeout(300)) {
+  serial_pipes(3, 8, 1000);
+}
+
+// ----------------------------------------------------------------------------
+// Mixed pipes
+// ----------------------------------------------------------------------------
+
+// parallel pipes may run concurrently but never more than L tokens at a time
+void mixed_pipes(unsigned w, size_t L, size_t N) {
+
+  tf::Executor executor(w);
+  tf::Taskflow taskflow;
+
+  std::atomic<size_t> in_flight {0};
+  std::atomic<size_t> max_in_flight {0};
+  std::atomic<size_t> sum {0};
+  std::vector<size_t> order;
+  std::vector<size_t> buffer(L);
+
+  tf::Pipeline pl(L,
+    tf::Pipe{tf::PipeType::SERIAL, [&](tf::Pipeflow& pf) {
+      if(pf.token() == N) {
+        pf.stop();
+        return;
+      }
+      buffer[pf.line()] = pf.token();
+      auto n = in_flight.fetch_add(1) + 1;
+      auto m = max_in_flight.load();
+      while(n > m && !max_in_flight.compare_exchange_weak(m, n));
+    }},
+    tf::Pipe{tf::PipeType::PARALLEL, [&](tf::Pipeflow& pf) {
+      sum.fetch_add(buffer[pf.line()]);
+    }},
+    tf::Pipe{tf::PipeType::SERIAL, [&](tf::Pipeflow& pf) {
+      order.push_back(buffer[pf.line()]);
+    }},
+    tf::Pipe{tf::PipeType::PARALLEL, [&](tf::Pipeflow&) {
+      in_flight.fetch_sub(1);
+    }}
+  );
+
+  auto init = taskflow.emplace([](){});
+  auto pipe = taskflow.pipeline(pl);
+  auto done = taskflow.emplace([&](){ REQUIRE(in_flight == 0); });
+
+  init.precede(pipe);
+  pipe.precede(done);
+
+  executor.run(taskflow).wait();
+
+  REQUIRE(sum == N*(N-1)/2);
+  REQUIRE(max_in_flight <= L);
+  REQUIRE(order.size() == N);
+  for(size_t i=0; i<N; i++) {
+    REQUIRE(order[i] == i);
+  }
+}
+
+TEST_CASE("Pipeline.Mixed.1L.2W" * doctest::timeout(300)) {
+  mixed_pipes(2, 1, 1000);
+}
+
+TEST_CASE("Pipeline.Mixed.2L.2W" * doctest::timeout(300)) {
+  mixed_pipes(2, 2, 1000);
+}
+
+TEST_CASE("Pipeline.Mixed.4L.3W" * doctest::timeout(300)) {
+  mixed_pipes(3, 4, 10000);
+}
+
+TEST_CASE("Pipeline.Mixed.16L.4W" * doctest::timeout(300)) {
+  mixed_pipes(4, 16, 10000);
+}
+
+// ----------------------------------------------------------------------------
+// Single pipe
+// ----------------------------------------------------------------------------
+
+TEST_CASE("Pipeline.SinglePipe" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  size_t count = 0;
+
+  tf::Pipeline pl(4, tf::Pipe{tf::PipeType::SERIAL, [&](tf::Pipeflow& pf) {
+    if(pf.token() == 1000) {
+      pf.stop();
+      return;
+    }
+    REQUIRE(pf.token() == count++);
+  }});
+
+  taskflow.pipeline(pl);
+  executor.run_n(taskflow, 3).wait();
+
+  REQUIRE(count == 1000);
+  REQUIRE(pl.num_tokens() == 1000);
+}
+
+// ----------------------------------------------------------------------------
+// Stop at a non-first pipe
+// ----------------------------------------------------------------------------
+
+TEST_CASE("Pipeline.StopAtNonFirstPipe" * doctest::timeout(300)) {
+
+  tf::Executor executor(1);
+  tf::Taskflow taskflow;
+
+  bool thrown = false;
+
+  tf::Pipeline pl(1,
+    tf::Pipe{tf::PipeType::SERIAL, [](tf::Pipeflow& pf) {
+      if(pf.token() == 1) {
+        pf.stop();
+      }
+    }},
+    tf::Pipe{tf::PipeType::SERIAL, [&](tf::Pipeflow& pf) {
+      try {
+        pf.stop();
+      }
+      catch(const std::exception&) {
+        thrown = true;
+      }
+    }}
+  );
+
+  taskflow.pipeline(pl);
+  executor.run(taskflow).wait();
+
+  REQUIRE(thrown);
+}
+
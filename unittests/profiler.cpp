@@ -0,0 +1,509 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest.h>
+#include <taskflow/taskflow.hpp>
+
+// loads all chunks of a streamed profile file
+std::vector<tf::ProfileData> load_chunks(const std::string& path) {
+  std::vector<tf::ProfileData> chunks;
+  std::ifstream ifs(path, std::ios::binary);
+  tf::Deserializer<std::ifstream> deserializer(ifs);
+  while(ifs.peek() != std::ifstream::traits_type::eof()) {
+    deserializer(chunks.emplace_back());
+  }
+  return chunks;
+}
+
+// --------------------------------------------------------
+// Testcase: StreamObserver
+// --------------------------------------------------------
+
+void stream_observer(unsigned W) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  const std::string prefix = "stream_observer_" + std::to_string(W);
+
+  const size_t N = 1000;
+  const size_t R = 10;
+
+  for(size_t i=0; i<N; i++) {
+    taskflow.emplace([](){}).name("task_" + std::to_string(i % 10));
+  }
+
+  std::vector<std::string> files;
+  size_t num_segments = 0;
+
+  {
+    tf::TFProfStreamOptions options;
+    options.capacity = N * R;
+    options.interval = std::chrono::milliseconds(10);
+
+    auto observer = executor.make_observer<tf::TFProfStreamObserver>(
+      prefix, options
+    );
+
+    for(size_t r=0; r<R; r++) {
+      executor.run(taskflow).wait();
+    }
+
+    observer->flush();
+
+    REQUIRE(observer->num_dropped() == 0);
+    REQUIRE(observer->num_segments() == N * R);
+
+    files = observer->files();
+    REQUIRE(files.size() == 1);
+    REQUIRE(files[0] == prefix + ".0.tfp");
+
+    executor.remove_observer(std::move(observer));
+  }
+
+  std::set<size_t> uids;
+  std::map<std::string, size_t> names;
+
+  for(auto& chunk : load_chunks(files[0])) {
+    REQUIRE(chunk.timelines.size() == 1);
+    REQUIRE(chunk.timelines[0].segments.size() == W);
+    uids.insert(chunk.timelines[0].uid);
+    for(auto& worker : chunk.timelines[0].segments) {
+      for(auto& level : worker) {
+        for(auto& s : level) {
+          REQUIRE(s.type == tf::TaskType::STATIC);
+          REQUIRE(s.beg <= s.end);
+          names[s.name]++;
+          num_segments++;
+        }
+      }
+    }
+  }
+
+  REQUIRE(uids.size() == 1);
+  REQUIRE(num_segments == N * R);
+  REQUIRE(names.size() == 10);
+  for(size_t i=0; i<10; i++) {
+    REQUIRE(names["task_" + std::to_string(i)] == N * R / 10);
+  }
+
+  std::remove(files[0].c_str());
+}
+
+TEST_CASE("StreamObserver.1thread" * doctest::timeout(300)) {
+  stream_observer(1);
+}
+
+TEST_CASE("StreamObserver.2threads" * doctest::timeout(300)) {
+  stream_observer(2);
+}
+
+TEST_CASE("StreamObserver.4threads" * doctest::timeout(300)) {
+  stream_observer(4);
+}
+
+// --------------------------------------------------------
+// Testcase: StreamObserver.Rotation
+// --------------------------------------------------------
+
+TEST_CASE("StreamObserver.Rotation" * doctest::timeout(300)) {
+
+  tf::Executor executor(2);
+  tf::Taskflow taskflow;
+
+  const std::string prefix = "stream_observer_rotation";
+
+  for(size_t i=0; i<100; i++) {
+    taskflow.emplace([](){}).name("task");
+  }
+
+  tf::TFProfStreamOptions options;
+  options.interval = std::chrono::hours(1);
+  options.max_file_size = 1;
+  options.max_files = 3;
+
+  auto observer = executor.make_observer<tf::TFProfStreamObserver>(
+    prefix, options
+  );
+
+  // every chunk exceeds the file size and ends its file
+  for(size_t r=0; r<10; r++) {
+    executor.run(taskflow).wait();
+    observer->flush();
+  }
+
+  auto files = observer->files();
+
+  REQUIRE(observer->num_segments() == 1000);
+  REQUIRE(files.size() == 3);
+
+  for(size_t i=0; i<10; i++) {
+    auto path = prefix + '.' + std::to_string(i) + ".tfp";
+    REQUIRE(std::ifstream(path).good() == (i >= 7));
+  }
+
+  for(size_t i=0; i<3; i++) {
+    REQUIRE(files[i] == prefix + '.' + std::to_string(i+7) + ".tfp");
+    auto chunks = load_chunks(files[i]);
+    REQUIRE(chunks.size() == 1);
+    size_t n = 0;
+    for(auto& worker : chunks[0].timelines[0].segments) {
+      for(auto& level : worker) {
+        n += level.size();
+      }
+    }
+    REQUIRE(n == 100);
+    std::remove(files[i].c_str());
+  }
+}
+
+// --------------------------------------------------------
+// Testcase: StreamObserver.Dropped
+// --------------------------------------------------------
+
+TEST_CASE("StreamObserver.Dropped" * doctest::timeout(300)) {
+
+  tf::Executor executor(1);
+  tf::Taskflow taskflow;
+
+  const std::string prefix = "stream_observer_dropped";
+
+  for(size_t i=0; i<1000; i++) {
+    taskflow.emplace([](){});
+  }
+
+  tf::TFProfStreamOptions options;
+  options.capacity = 64;
+  options.interval = std::chrono::hours(1);
+
+  auto observer = executor.make_observer<tf::TFProfStreamObserver>(
+    prefix, options
+  );
+
+  executor.run(taskflow).wait();
+  observer->flush();
+
+  // an observer streams the workers of only one executor
+  REQUIRE_THROWS(static_cast<tf::ObserverInterface&>(*observer).set_up(1));
+
+  // the early drain of a half-full buffer may keep up with the worker
+  REQUIRE(observer->num_segments() >= 64);
+  REQUIRE(observer->num_segments() + observer->num_dropped() == 1000);
+
+  for(auto& file : observer->files()) {
+    std::remove(file.c_str());
+  }
+}
+
+// --------------------------------------------------------
+// Testcase: StreamObserver.Names
+// --------------------------------------------------------
+
+TEST_CASE("StreamObserver.Names" * doctest::timeout(300)) {
+
+  tf::Executor executor(4);
+  tf::Taskflow taskflow;
+
+  const std::string prefix = "stream_observer_names";
+
+  for(size_t i=0; i<1000; i++) {
+    taskflow.emplace([](){}).name(std::to_string(i));
+  }
+
+  tf::TFProfStreamOptions options;
+  options.interval = std::chrono::milliseconds(1);
+  options.max_names = 100;
+
+  std::vector<std::string> files;
+
+  // workers intern new names while the background thread drains
+  {
+    auto observer = executor.make_observer<tf::TFProfStreamObserver>(
+      prefix, options
+    );
+    executor.run(taskflow).wait();
+    observer->flush();
+    REQUIRE(observer->num_segments() == 1000);
+    files = observer->files();
+    executor.remove_observer(std::move(observer));
+  }
+
+  std::map<std::string, size_t> names;
+  for(auto& file : files) {
+    for(auto& chunk : load_chunks(file)) {
+      for(auto& worker : chunk.timelines[0].segments) {
+        for(auto& level : worker) {
+          for(auto& s : level) {
+            names[s.name]++;
+          }
+        }
+      }
+    }
+    std::remove(file.c_str());
+  }
+
+  // names beyond the limit are recorded as unnamed
+  REQUIRE(names.size() == 101);
+  REQUIRE(names[""] == 900);
+}
+
+// --------------------------------------------------------
+// Testcase: StreamObserver.Subflow
+// --------------------------------------------------------
+
+TEST_CASE("StreamObserver.Subflow" * doctest::timeout(300)) {
+
+  const std::string prefix = "stream_observer_subflow";
+
+  // the executor destroys the observer, which writes the remaining segments
+  {
+    tf::Executor executor(2);
+    tf::Taskflow taskflow;
+
+    taskflow.emplace([](tf::Subflow& sf){
+      for(size_t i=0; i<10; i++) {
+        sf.emplace([](){}).name("child");
+      }
+      sf.join();
+    }).name("parent");
+    
+    executor.make_observer<tf::TFProfStreamObserver>(prefix);
+    executor.run(taskflow).wait();
+  }
+
+  std::map<std::string, size_t> names;
+
+  for(auto& chunk : load_chunks(prefix + ".0.tfp")) {
+    for(auto& worker : chunk.timelines[0].segments) {
+      for(size_t l=0; l<worker.size(); l++) {
+        for(auto& s : worker[l]) {
+          REQUIRE((s.name == "child" || l == 0));
+          names[s.name]++;
+        }
+      }
+    }
+  }
+
+  REQUIRE(names.size() == 2);
+  REQUIRE(names["parent"] == 1);
+  REQUIRE(names["child"] == 10);
+
+  std::remove((prefix + ".0.tfp").c_str());
+}
+
+// --------------------------------------------------------
+// Testcase: Observer.Runtime
+// --------------------------------------------------------
+
+void runtime_observer(unsigned W) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  std::atomic<bool> stop {false};
+
+  for(size_t i=0; i<100; i++) {
+    taskflow.emplace([](){}).name("task");
+  }
+
+  taskflow.emplace([](tf::Subflow& sf){
+    sf.emplace([](){}).name("child");
+  }).name("parent");
+
+  auto future = executor.run_until(taskflow, [&](){ return stop.load(); });
+
+  // attaches and detaches observers while the executor runs
+  for(size_t r=0; r<10; r++) {
+
+    auto observer = executor.make_observer<tf::TFProfObserver>();
+
+    while(observer->num_tasks() < 1000) {
+      std::this_thread::yield();
+    }
+
+    observer->clear();
+    
+    while(observer->num_tasks() < 100) {
+      std::this_thread::yield();
+    }
+    
+    REQUIRE(observer->dump().size() > 0);
+
+    executor.remove_observer(std::move(observer));
+  }
+    
+  stop = true;
+  future.get();
+}
+
+TEST_CASE("Observer.Runtime.1thread" * doctest::timeout(300)) {
+  runtime_observer(1);
+}
+
+TEST_CASE("Observer.Runtime.2threads" * doctest::timeout(300)) {
+  runtime_observer(2);
+}
+
+TEST_CASE("Observer.Runtime.4threads" * doctest::timeout(300)) {
+  runtime_observer(4);
+}
+
+// --------------------------------------------------------
+// Testcase: Observer.Snapshot
+// --------------------------------------------------------
+
+TEST_CASE("Observer.Snapshot" * doctest::timeout(300)) {
+
+  tf::Executor executor(2);
+  tf::Taskflow taskflow1, taskflow2;
+
+  for(size_t i=0; i<100; i++) {
+    taskflow1.emplace([](){}).name("old");
+    taskflow2.emplace([](){}).name("new");
+  }
+
+  auto observer = executor.make_observer<tf::TFProfObserver>();
+
+  executor.run(taskflow1).wait();
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  executor.run(taskflow2).wait();
+
+  auto count = [] (const std::string& path) {
+    std::map<std::string, size_t> names;
+    auto chunks = load_chunks(path);
+    REQUIRE(chunks.size() == 1);
+    REQUIRE(chunks[0].timelines.size() == 1);
+    for(auto& worker : chunks[0].timelines[0].segments) {
+      for(auto& level : worker) {
+        for(auto& s : level) {
+          names[s.name]++;
+        }
+      }
+    }
+    std::remove(path.c_str());
+    return names;
+  };
+
+  observer->snapshot("observer_snapshot_all.tfp");
+  observer->snapshot("observer_snapshot_last.tfp", std::chrono::milliseconds(250));
+
+  auto all = count("observer_snapshot_all.tfp");
+  REQUIRE(all.size() == 2);
+  REQUIRE(all["old"] == 100);
+  REQUIRE(all["new"] == 100);
+
+  auto last = count("observer_snapshot_last.tfp");
+  REQUIRE(last.size() == 1);
+  REQUIRE(last["new"] == 100);
+
+  observer->snapshot("observer_snapshot.json");
+  std::ifstream ifs("observer_snapshot.json");
+  std::string json((std::istreambuf_iterator<char>(ifs)), {});
+  REQUIRE(json.front() == '[');
+  REQUIRE(json.find("\"name\":\"new\"") != std::string::npos);
+  std::remove("observer_snapshot.json");
+
+  REQUIRE_THROWS(observer->snapshot("no_such_directory/snapshot.tfp"));
+}
+
+// --------------------------------------------------------
+// Testcase: Observer.Control
+// --------------------------------------------------------
+
+TEST_CASE("Observer.Control" * doctest::timeout(300)) {
+
+  auto& manager = tf::TFProfManager::get();
+
+  tf::Executor executor1(2), executor2(2);
+  tf::Taskflow taskflow;
+
+  for(size_t i=0; i<100; i++) {
+    taskflow.emplace([](){}).name("task");
+  }
+  
+  auto count = [] (const std::string& path) {
+    size_t n = 0;
+    auto chunks = load_chunks(path);
+    REQUIRE(chunks.size() == 1);
+    REQUIRE(chunks[0].timelines.size() == 2);
+    for(auto& timeline : chunks[0].timelines) {
+      for(auto& worker : timeline.segments) {
+        for(auto& level : worker) {
+          n += level.size();
+        }
+      }
+    }
+    std::remove(path.c_str());
+    return n;
+  };
+
+  REQUIRE(manager.control("start"));
+  REQUIRE(manager.control("start"));
+  REQUIRE(executor1.num_observers() == 1);
+  REQUIRE(executor2.num_observers() == 1);
+
+  executor1.run(taskflow).wait();
+  executor2.run(taskflow).wait();
+
+  REQUIRE(manager.control("snapshot observer_control.tfp"));
+  REQUIRE(count("observer_control.tfp") == 200);
+  
+  REQUIRE(manager.control("snapshot observer_control.tfp 60"));
+  REQUIRE(count("observer_control.tfp") == 200);
+  
+  REQUIRE(manager.control("clear"));
+  REQUIRE(manager.control("snapshot observer_control.tfp"));
+  REQUIRE(count("observer_control.tfp") == 0);
+  
+  REQUIRE(manager.control("stop"));
+  REQUIRE(executor1.num_observers() == 0);
+  REQUIRE(executor2.num_observers() == 0);
+
+  REQUIRE(!manager.control(""));
+  REQUIRE(!manager.control("restart"));
+  REQUIRE(!manager.control("snapshot"));
+  REQUIRE(!manager.control("snapshot observer_control.tfp 0"));
+  REQUIRE(!manager.control("snapshot observer_control.tfp -1"));
+  REQUIRE(!manager.control("snapshot observer_control.tfp nan"));
+  REQUIRE(!manager.control("snapshot observer_control.tfp inf"));
+  REQUIRE(!manager.control("snapshot observer_control.tfp 1e400"));
+  REQUIRE(!manager.control("snapshot observer_control.tfp ten"));
+  REQUIRE(!manager.control("snapshot observer_control.tfp 10 s"));
+  REQUIRE(!std::ifstream("observer_control.tfp").good());
+  
+  // a period beyond the range of the clock covers the whole profile
+  REQUIRE(manager.control("snapshot observer_control.tfp 1e300"));
+  std::remove("observer_control.tfp");
+  
+  // an executor destroyed with an attached observer unregisters itself
+  REQUIRE(manager.control("start"));
+}
+
+// --------------------------------------------------------
+// Testcase: Observer.Control.Release
+// --------------------------------------------------------
+
+TEST_CASE("Observer.Control.Release" * doctest::timeout(300)) {
+
+  auto& manager = tf::TFProfManager::get();
+
+  tf::Executor executor(2);
+  tf::Taskflow taskflow;
+
+  for(size_t i=0; i<100; i++) {
+    taskflow.emplace([](){}).name("task");
+  }
+
+  REQUIRE(manager.observer(executor) == nullptr);
+
+  // every stop releases the observer of the previous start
+  for(size_t r=0; r<10; r++) {
+    REQUIRE(manager.control("start"));
+    std::weak_ptr<tf::TFProfObserver> observer = manager.observer(executor);
+    REQUIRE(!observer.expired());
+    executor.run(taskflow).wait();
+    REQUIRE(observer.lock()->num_tasks() == 100);
+    REQUIRE(manager.control("stop"));
+    REQUIRE(manager.observer(executor) == nullptr);
+    REQUIRE(observer.expired());
+  }
+}
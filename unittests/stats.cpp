@@ -0,0 +1,218 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define TF_ENABLE_STATS
+
+#include <doctest.h>
+#include <taskflow/taskflow.hpp>
+
+// --------------------------------------------------------
+// Testcase: Stats
+// --------------------------------------------------------
+
+void stats(unsigned W) {
+
+  tf::Executor executor(W);
+  tf::Taskflow taskflow;
+
+  const size_t N = 1000;
+
+  std::atomic<size_t> counter {0};
+
+  auto cond = taskflow.emplace([](){ return 0; });
+  auto subflow = taskflow.emplace([&](tf::Subflow& sf){
+    for(size_t i=0; i<N; i++) {
+      sf.emplace([&](){ counter++; });
+    }
+  });
+  cond.precede(subflow);
+
+  executor.run_n(taskflow, 10).wait();
+
+  for(size_t i=0; i<N; i++) {
+    executor.silent_async([&](){ counter++; });
+  }
+  executor.wait_for_all();
+
+  REQUIRE(counter == 11*N);
+
+  auto stats = executor.stats();
+  // the last entry belongs to the threads running tasks in run_and_wait
+  REQUIRE(stats.size() == W + 1);
+  REQUIRE(stats[W].num_tasks_of(tf::TaskType::STATIC) == 0);
+
+  size_t num_static {0}, num_dynamic {0}, num_condition {0}, num_async {0};
+  size_t num_steals {0};
+
+  for(auto& s : stats) {
+    num_static += s.num_tasks_of(tf::TaskType::STATIC);
+    num_dynamic += s.num_tasks_of(tf::TaskType::DYNAMIC);
+    num_condition += s.num_tasks_of(tf::TaskType::CONDITION);
+    num_async += s.num_tasks_of(tf::TaskType::ASYNC);
+    num_steals += s.num_steals;
+    REQUIRE(s.num_steals_from.size() == W + 1);
+    REQUIRE(std::accumulate(
+      s.num_steals_from.begin(), s.num_steals_from.end(), size_t{0}
+    ) == s.num_steals);
+    REQUIRE(s.park_time.count() >= 0);
+  }
+
+  REQUIRE(num_static == 10*N);
+  REQUIRE(num_dynamic == 10);
+  REQUIRE(num_condition == 10);
+  REQUIRE(num_async == N);
+
+  // the run and every async task submitted from outside the executor 
+  // are stolen from the shared queue
+  REQUIRE(num_steals >= 1 + N);
+}
+
+TEST_CASE("Stats.1thread" * doctest::timeout(300)) {
+  stats(1);
+}
+
+TEST_CASE("Stats.2threads" * doctest::timeout(300)) {
+  stats(2);
+}
+
+TEST_CASE("Stats.4threads" * doctest::timeout(300)) {
+  stats(4);
+}
+
+// --------------------------------------------------------
+// Testcase: Stats.RunAndWait
+// --------------------------------------------------------
+
+TEST_CASE("Stats.RunAndWait" * doctest::timeout(300)) {
+
+  tf::Executor executor(1);
+  tf::Taskflow taskflow;
+
+  // both tasks wait for each other, so the caller must run one of them
+  std::atomic<size_t> arrived {0};
+  for(int i=0; i<2; i++) {
+    taskflow.emplace([&](){ 
+      arrived++;
+      while(arrived % 2) {
+        std::this_thread::yield();
+      }
+    });
+  }
+
+  for(int r=0; r<10; r++) {
+    executor.run_and_wait(taskflow);
+  }
+
+  auto stats = executor.stats();
+  REQUIRE(stats.size() == 2);
+
+  // the tasks run by the caller count in the trailing entry
+  REQUIRE(stats[0].num_tasks_of(tf::TaskType::STATIC) == 10);
+  REQUIRE(stats[1].num_tasks_of(tf::TaskType::STATIC) == 10);
+  REQUIRE(stats[1].num_steals_from.size() == 2);
+  REQUIRE(stats[1].latency.count() == 10);
+  REQUIRE(executor.latency().count() == 20);
+}
+
+// --------------------------------------------------------
+// Testcase: Stats.Parks
+// --------------------------------------------------------
+
+TEST_CASE("Stats.Parks" * doctest::timeout(300)) {
+
+  tf::Executor executor(2);
+
+  for(int i=0; i<10; i++) {
+    executor.silent_async([](){});
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  executor.wait_for_all();
+
+  size_t num_parks {0};
+  std::chrono::nanoseconds park_time {0};
+  for(auto& s : executor.stats()) {
+    num_parks += s.num_parks;
+    park_time += s.park_time;
+  }
+  REQUIRE(num_parks > 0);
+  REQUIRE(park_time.count() > 0);
+}
+
+// --------------------------------------------------------
+// Testcase: LatencyHistogram
+// --------------------------------------------------------
+
+TEST_CASE("LatencyHistogram" * doctest::timeout(300)) {
+
+  using tf::LatencyHistogram;
+
+  // every value lies within the bounds of its bucket
+  for(uint64_t ns : {uint64_t{0}, uint64_t{1}, uint64_t{15}, uint64_t{16}, 
+                     uint64_t{17}, uint64_t{1000}, uint64_t{123456789}, 
+                     uint64_t{1} << 40}) {
+    auto b = LatencyHistogram::bucket(ns);
+    REQUIRE(b < LatencyHistogram::num_buckets);
+    REQUIRE(LatencyHistogram::upper_bound(b) >= ns);
+    REQUIRE(LatencyHistogram::upper_bound(b) - ns <= ns / 16);
+    if(b > 0) {
+      REQUIRE(LatencyHistogram::upper_bound(b-1) < ns);
+    }
+  }
+
+  LatencyHistogram h;
+  REQUIRE(h.count() == 0);
+  REQUIRE(h.p99().count() == 0);
+
+  for(int i=1; i<=1000; i++) {
+    h.record(std::chrono::microseconds(i));
+  }
+
+  REQUIRE(h.count() == 1000);
+  REQUIRE(h.max() == std::chrono::microseconds(1000));
+
+  auto within = [] (std::chrono::nanoseconds v, std::chrono::microseconds e) {
+    return v >= e && v <= e + e/16;
+  };
+
+  REQUIRE(within(h.p50(), std::chrono::microseconds(500)));
+  REQUIRE(within(h.p99(), std::chrono::microseconds(990)));
+  REQUIRE(within(h.p999(), std::chrono::microseconds(999)));
+  REQUIRE(h.percentile(1.0) == h.max());
+
+  LatencyHistogram g;
+  g.record(std::chrono::seconds(1));
+  g.merge(h);
+  REQUIRE(g.count() == 1001);
+  REQUIRE(g.max() == std::chrono::seconds(1));
+}
+
+// --------------------------------------------------------
+// Testcase: Latency
+// --------------------------------------------------------
+
+TEST_CASE("Latency" * doctest::timeout(300)) {
+
+  tf::Executor executor(1);
+
+  REQUIRE(executor.latency().count() == 0);
+
+  // the second task waits for the first one on the only worker
+  executor.silent_async([](){
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  });
+  executor.silent_async([](){});
+  executor.wait_for_all();
+
+  tf::Taskflow taskflow;
+  for(int i=0; i<100; i++) {
+    taskflow.emplace([](){});
+  }
+  executor.run(taskflow).wait();
+
+  auto h = executor.latency();
+  REQUIRE(h.count() == 102);
+  REQUIRE(h.max() >= std::chrono::milliseconds(20));
+  REQUIRE(h.p50() <= h.p99());
+  REQUIRE(h.p99() <= h.p999());
+  REQUIRE(h.p999() <= h.max());
+  REQUIRE(executor.stats()[0].latency.count() == 102);
+}
@@ -437,6 +437,49 @@ TEST_CASE("ObjectPool.16threads" * doctest::timeout(300)) {
   threaded_objectpool<Poolable>(16);
 } 
 
+// --------------------------------------------------------
+// Testcase: ObjectPool.AnimateN
+// --------------------------------------------------------
+struct ConstructedPoolable {
+  
+  ConstructedPoolable(std::string s, size_t n) : str {std::move(s)}, vec(n) {}
+
+  std::string str;
+  std::vector<int> vec;
+
+  TF_ENABLE_POOLABLE_ON_THIS;
+};
+
+TEST_CASE("ObjectPool.AnimateN" * doctest::timeout(300)) {
+
+  tf::ObjectPool<ConstructedPoolable> pool(1);
+
+  // spans several blocks
+  size_t N = 3*pool.num_objects_per_block() + 7;
+
+  std::vector<ConstructedPoolable*> items(N);
+
+  pool.animate_n(items.data(), N, [] (size_t i) {
+    return std::make_tuple(std::to_string(i), i % 5);
+  });
+
+  std::set<ConstructedPoolable*> set(items.begin(), items.end());
+  REQUIRE(set.size() == N);
+  REQUIRE(pool.num_allocated_objects() == N);
+
+  for(size_t i=0; i<N; ++i) {
+    REQUIRE(items[i]->str == std::to_string(i));
+    REQUIRE(items[i]->vec.size() == i % 5);
+  }
+
+  for(auto item : items) {
+    pool.recycle(item);
+  }
+  
+  REQUIRE(pool.num_allocated_objects() == 0);
+  REQUIRE(pool.num_available_objects() == pool.capacity());
+}
+
 // --------------------------------------------------------
 // Testcase: Reference Wrapper
 // --------------------------------------------------------